@@ -0,0 +1,122 @@
+#pragma once
+
+#include "hash_eval.c"
+#include "isa.c"
+
+#include <immintrin.h>
+#include <stddef.h>
+
+// Batch evaluation over the hash evaluator tables. The vector kernels do the same suit
+// extraction, key sums and table loads as eval_hand_hash, using gathers for 4 (AVX2) or 8
+// (AVX-512) hands at a time, and finish any remainder with the scalar kernel.
+//
+// This is for arrays of unrelated hands. The solver's dealer loop scores every hand against one
+// fixed board, so it uses board_eval.c instead, which skips re-deriving the board for each hand:
+// about 9 ns a dealer hole there against 11 to 13 ns for filling and batch-scoring the holes.
+
+void eval_hand_batch_scalar(const uint64_t *hands, uint32_t *scores, size_t n) {
+        for (size_t i = 0; i < n; i += 1) {
+                scores[i] = eval_hand_hash(hands[i]);
+        }
+}
+
+__attribute__((target("avx2"))) void eval_hand_batch_avx2(const uint64_t *hands,
+                                                          uint32_t *scores, size_t n) {
+        const int *rank_keys = (const int *)hash_eval_table->rank_keys;
+        const int *flush_scores = (const int *)hash_eval_table->flush_scores;
+        const int *rank_scores = (const int *)hash_eval_table->rank_scores;
+        const __m256i rank_mask = _mm256_set1_epi64x(RANK_MASK);
+        const __m128i score_mask = _mm_set1_epi32(0xFFFF);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+                __m256i v = _mm256_loadu_si256((const __m256i *)(hands + i));
+                __m256i s = _mm256_and_si256(v, rank_mask);
+                __m256i h = _mm256_and_si256(_mm256_srli_epi64(v, HEART_OFFSET), rank_mask);
+                __m256i d = _mm256_and_si256(_mm256_srli_epi64(v, DIAMOND_OFFSET), rank_mask);
+                __m256i c = _mm256_and_si256(_mm256_srli_epi64(v, CLUB_OFFSET), rank_mask);
+
+                __m128i key = _mm_add_epi32(
+                    _mm_add_epi32(_mm256_i64gather_epi32(rank_keys, s, 4),
+                                  _mm256_i64gather_epi32(rank_keys, h, 4)),
+                    _mm_add_epi32(_mm256_i64gather_epi32(rank_keys, d, 4),
+                                  _mm256_i64gather_epi32(rank_keys, c, 4)));
+                __m128i score =
+                    _mm_and_si128(_mm_i32gather_epi32(rank_scores, key, 2), score_mask);
+
+                __m128i flush = _mm_min_epu32(
+                    _mm_min_epu32(_mm256_i64gather_epi32(flush_scores, s, 2),
+                                  _mm256_i64gather_epi32(flush_scores, h, 2)),
+                    _mm_min_epu32(_mm256_i64gather_epi32(flush_scores, d, 2),
+                                  _mm256_i64gather_epi32(flush_scores, c, 2)));
+                flush = _mm_and_si128(flush, score_mask);
+
+                _mm_storeu_si128((__m128i *)(scores + i), _mm_min_epu32(score, flush));
+        }
+
+        eval_hand_batch_scalar(hands + i, scores + i, n - i);
+}
+
+__attribute__((target("avx512f"))) void eval_hand_batch_avx512(const uint64_t *hands,
+                                                               uint32_t *scores, size_t n) {
+        const int *rank_keys = (const int *)hash_eval_table->rank_keys;
+        const int *flush_scores = (const int *)hash_eval_table->flush_scores;
+        const int *rank_scores = (const int *)hash_eval_table->rank_scores;
+        const __m512i rank_mask = _mm512_set1_epi64(RANK_MASK);
+        const __m256i score_mask = _mm256_set1_epi32(0xFFFF);
+
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+                __m512i v = _mm512_loadu_si512(hands + i);
+                __m512i s = _mm512_and_si512(v, rank_mask);
+                __m512i h = _mm512_and_si512(_mm512_srli_epi64(v, HEART_OFFSET), rank_mask);
+                __m512i d = _mm512_and_si512(_mm512_srli_epi64(v, DIAMOND_OFFSET), rank_mask);
+                __m512i c = _mm512_and_si512(_mm512_srli_epi64(v, CLUB_OFFSET), rank_mask);
+
+                __m256i key = _mm256_add_epi32(
+                    _mm256_add_epi32(_mm512_i64gather_epi32(s, rank_keys, 4),
+                                     _mm512_i64gather_epi32(h, rank_keys, 4)),
+                    _mm256_add_epi32(_mm512_i64gather_epi32(d, rank_keys, 4),
+                                     _mm512_i64gather_epi32(c, rank_keys, 4)));
+                __m256i score =
+                    _mm256_and_si256(_mm256_i32gather_epi32(rank_scores, key, 2), score_mask);
+
+                __m256i flush = _mm256_min_epu32(
+                    _mm256_min_epu32(_mm512_i64gather_epi32(s, flush_scores, 2),
+                                     _mm512_i64gather_epi32(h, flush_scores, 2)),
+                    _mm256_min_epu32(_mm512_i64gather_epi32(d, flush_scores, 2),
+                                     _mm512_i64gather_epi32(c, flush_scores, 2)));
+                flush = _mm256_and_si256(flush, score_mask);
+
+                _mm256_storeu_si256((__m256i *)(scores + i), _mm256_min_epu32(score, flush));
+        }
+
+        eval_hand_batch_scalar(hands + i, scores + i, n - i);
+}
+
+void (*eval_hand_batch_kernel)(const uint64_t *hands, uint32_t *scores, size_t n) = NULL;
+
+/**
+ * Picks the widest batch kernel the selected instruction set level has
+ */
+void init_batch_eval() {
+        enum Isa isa = init_isa();
+        if (isa >= ISA_X86_64_V4) {
+                eval_hand_batch_kernel = eval_hand_batch_avx512;
+        } else if (isa >= ISA_X86_64_V3) {
+                eval_hand_batch_kernel = eval_hand_batch_avx2;
+        } else {
+                eval_hand_batch_kernel = eval_hand_batch_scalar;
+        }
+}
+
+/**
+ * Scores `n` hands into `scores`, with the same results as eval_hand. Requires init_hash_eval.
+ */
+void eval_hand_batch(const uint64_t *hands, uint32_t *scores, size_t n) {
+        if (!eval_hand_batch_kernel) {
+                init_batch_eval();
+        }
+
+        eval_hand_batch_kernel(hands, scores, n);
+}
@@ -1,81 +1,383 @@
-#include "eval.c"
+#include "batch_eval.c"
+#include "combination.c"
+#include "engine.c"
 
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 
-int main() {
-        init_high_cards();
-
-        const uint64_t suits[4] = {
-            CLUB_BITMASK,
-            DIAMOND_BITMASK,
-            HEART_BITMASK,
-            SPADE_BITMASK,
-        };
-        const uint64_t ranks[13] = {
-            DEUCE_BITMASK, TREY_BITMASK,  FOUR_BITMASK, FIVE_BITMASK, SIX_BITMASK,
-            SEVEN_BITMASK, EIGHT_BITMASK, NINE_BITMASK, TEN_BITMASK,  JACK_BITMASK,
-            QUEEN_BITMASK, KING_BITMASK,  ACE_BITMASK,
-        };
-
-        uint64_t cards[52];
-
-        for (int i = 0; i < 52; i += 1) {
-                cards[i] = suits[i % 4] & ranks[i % 13];
-        }
-
-        uint32_t count = 0;
-        clock_t begin = clock();
-        for (int c1 = 0; c1 < 52 - 6; c1 += 1) {
-                for (int c2 = c1 + 1; c2 < 52 - 5; c2 += 1) {
-                        for (int c3 = c2 + 1; c3 < 52 - 4; c3 += 1) {
-                                for (int c4 = c3 + 1; c4 < 52 - 3; c4 += 1) {
-                                        for (int c5 = c4 + 1; c5 < 52 - 2; c5 += 1) {
-                                                for (int c6 = c5 + 1; c6 < 52 - 1; c6 += 1) {
-                                                        for (int c7 = c6 + 1; c7 < 52; c7 += 1) {
-                                                                uint64_t hand =
-                                                                    cards[c1] | cards[c2] |
-                                                                    cards[c3] | cards[c4] |
-                                                                    cards[c5] | cards[c6] |
-                                                                    cards[c7];
-                                                                count += 1;
-                                                        }
-                                                }
-                                        }
-                                }
+// Evaluator benchmark. Each workload is a fixed array of hands built before timing starts, so
+// only evaluation is measured. Every run is warmed up once and then repeated, and all scores are
+// summed into a checksum that is printed, so the compiler can't drop the evaluation and engines
+// can be checked against each other.
+
+// Names the compiler flags the binary was built with, so results from several builds can be
+// compared. Set by `make bench`.
+#ifndef BENCH_BUILD
+#define BENCH_BUILD "default"
+#endif
+
+#define ALL_HANDS 133784560 // 52 choose 7
+#define BATCH_SIZE 4096
+
+enum Workload {
+        WORKLOAD_SEQUENTIAL,
+        WORKLOAD_RANDOM,
+        WORKLOAD_FLUSH,
+        WORKLOAD_PAIR,
+        WORKLOAD_DEALER,
+        NUM_WORKLOADS
+};
+
+const char *WORKLOAD_NAMES[NUM_WORKLOADS] = {"sequential", "random", "flush", "pair", "dealer"};
+
+// The per-hand engines from engine.c, then the batch kernels from batch_eval.c
+enum BenchEngine {
+        BENCH_BRANCHY,
+        BENCH_HASH,
+        BENCH_BATCH_SCALAR,
+        BENCH_BATCH_AVX2,
+        BENCH_BATCH_AVX512,
+        NUM_BENCH_ENGINES
+};
+
+const char *BENCH_ENGINE_NAMES[NUM_BENCH_ENGINES] = {"branchy", "hash", "batch-scalar",
+                                                     "batch-avx2", "batch-avx512"};
+
+struct BenchResult {
+        double mean;
+        double stddev;
+        double min;
+        uint64_t checksum;
+};
+
+uint64_t random_state = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * splitmix64, fixed-seeded so every run benchmarks the same hands
+ */
+uint64_t next_random() {
+        uint64_t z = (random_state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+}
+
+Card random_card() {
+        uint64_t index = next_random() % 52;
+        return 1ull << (16 * (index / 13) + index % 13);
+}
+
+/**
+ * Adds random cards to `cards` until it holds `count`
+ */
+Card add_random_cards(Card cards, uint32_t count) {
+        while (__builtin_popcountll(cards) < count) {
+                cards |= random_card();
+        }
+        return cards;
+}
+
+/**
+ * Fills `hands` with `n` hands of `workload`
+ */
+void build_workload(enum Workload workload, uint64_t *hands, uint64_t n) {
+        struct CombinationIterator sequence;
+        combinations_start(&sequence, 7, FULL_DECK, 0);
+        uint64_t hand;
+
+        for (uint64_t i = 0; i < n;) {
+                switch (workload) {
+                case WORKLOAD_SEQUENTIAL:
+                        // The order the exhaustive enumerations visit hands, from the start again
+                        // after the last one
+                        hands[i++] = sequence.cards;
+                        if (!combinations_next(&sequence)) {
+                                combinations_start(&sequence, 7, FULL_DECK, 0);
+                        }
+                        break;
+                case WORKLOAD_RANDOM:
+                        hands[i++] = add_random_cards(0, 7);
+                        break;
+                case WORKLOAD_FLUSH: {
+                        // Five or more cards of one suit
+                        uint64_t suit = 16 * (next_random() % 4);
+                        Card flush = 0;
+                        while (__builtin_popcountll(flush) < 5) {
+                                flush |= 1ull << (suit + next_random() % 13);
+                        }
+                        hands[i++] = add_random_cards(flush, 7);
+                        break;
+                }
+                case WORKLOAD_PAIR:
+                        // One or two pairs, the bulk of what a dealer holds
+                        do {
+                                hand = add_random_cards(0, 7);
+                        } while (eval_hand(hand) < TWO_PAIR_INDEX ||
+                                 eval_hand(hand) >= HIGH_CARD_INDEX);
+                        hands[i++] = hand;
+                        break;
+                case WORKLOAD_DEALER: {
+                        // One board against all 990 dealer holes, as simulate_runout walks them
+                        Card hole = add_random_cards(0, 2);
+                        Card board = add_random_cards(hole, 7) ^ hole;
+                        struct CombinationIterator dealers;
+                        combinations_start(&dealers, 2, FULL_DECK ^ hole ^ board, 0);
+                        for (uint32_t k = 0; k < 990 && i < n; k += 1) {
+                                hands[i++] = board | dealers.cards;
+                                combinations_next(&dealers);
+                        }
+                        break;
+                }
+                default:
+                        return;
+                }
+        }
+}
+
+double now_seconds() {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+bool bench_engine_supported(enum BenchEngine engine) {
+        __builtin_cpu_init();
+        if (engine == BENCH_BATCH_AVX2) {
+                return __builtin_cpu_supports("avx2");
+        } else if (engine == BENCH_BATCH_AVX512) {
+                return __builtin_cpu_supports("avx512f");
+        }
+        return true;
+}
+
+/**
+ * Scores every hand once with `engine` and returns the sum of the scores
+ */
+uint64_t run_engine(enum BenchEngine engine, const uint64_t *hands, uint64_t n) {
+        uint64_t checksum = 0;
+
+        if (engine == BENCH_BRANCHY || engine == BENCH_HASH) {
+                uint32_t (*eval)(Card) =
+                    engine_functions[engine == BENCH_BRANCHY ? ENGINE_BRANCHY : ENGINE_HASH];
+                for (uint64_t i = 0; i < n; i += 1) {
+                        checksum += eval(hands[i]);
+                }
+                return checksum;
+        }
+
+        void (*kernel)(const uint64_t *, uint32_t *, size_t) =
+            engine == BENCH_BATCH_AVX512 ? eval_hand_batch_avx512
+            : engine == BENCH_BATCH_AVX2 ? eval_hand_batch_avx2
+                                         : eval_hand_batch_scalar;
+        uint32_t scores[BATCH_SIZE];
+        for (uint64_t i = 0; i < n; i += BATCH_SIZE) {
+                uint64_t count = n - i < BATCH_SIZE ? n - i : BATCH_SIZE;
+                kernel(hands + i, scores, count);
+                for (uint64_t j = 0; j < count; j += 1) {
+                        checksum += scores[j];
+                }
+        }
+        return checksum;
+}
+
+/**
+ * Enumerates and scores all 133,784,560 hands in place, or only enumerates them if `engine` is
+ * NUM_BENCH_ENGINES, and returns the checksum
+ */
+uint64_t run_exhaustive(enum BenchEngine engine) {
+        uint64_t hands[BATCH_SIZE];
+        uint64_t checksum = 0;
+
+        for (uint64_t i = 0; i < ALL_HANDS; i += BATCH_SIZE) {
+                uint64_t count = ALL_HANDS - i < BATCH_SIZE ? ALL_HANDS - i : BATCH_SIZE;
+                kernels->enumerate_combinations(7, FULL_DECK, i, hands, count);
+
+                if (engine == NUM_BENCH_ENGINES) {
+                        for (uint64_t j = 0; j < count; j += 1) {
+                                checksum += hands[j];
+                        }
+                } else {
+                        checksum += run_engine(engine, hands, count);
+                }
+        }
+        return checksum;
+}
+
+/**
+ * Times `repetitions` runs after one warmup, in ns per hand. With no hands, runs the exhaustive
+ * enumeration instead.
+ */
+struct BenchResult benchmark(enum BenchEngine engine, const uint64_t *hands, uint64_t n,
+                             uint32_t repetitions) {
+        struct BenchResult result = {0.0, 0.0, INFINITY, 0};
+        double sum = 0.0;
+        double sum_squares = 0.0;
+
+        for (uint32_t r = 0; r <= repetitions; r += 1) {
+                double start = now_seconds();
+                uint64_t checksum = hands ? run_engine(engine, hands, n) : run_exhaustive(engine);
+                double ns = (now_seconds() - start) * 1e9 / (hands ? n : ALL_HANDS);
+
+                result.checksum = checksum;
+                if (r == 0) { // warmup
+                        continue;
+                }
+                sum += ns;
+                sum_squares += ns * ns;
+                result.min = ns < result.min ? ns : result.min;
+        }
+
+        result.mean = sum / repetitions;
+        double variance = sum_squares / repetitions - result.mean * result.mean;
+        result.stddev = variance > 0.0 ? sqrt(variance) : 0.0;
+        return result;
+}
+
+void print_result(bool json, bool first, const char *engine, const char *workload, uint64_t n,
+                  const struct BenchResult *result) {
+        if (json) {
+                printf("%s\n    {\"engine\": \"%s\", \"workload\": \"%s\", \"hands\": %lu, "
+                       "\"ns_per_hand\": %.3f, \"stddev\": %.3f, \"min\": %.3f, "
+                       "\"checksum\": %lu}",
+                       first ? "" : ",", engine, workload, n, result->mean, result->stddev,
+                       result->min, result->checksum);
+        } else {
+                printf("%-13s %-11s %10lu hands %8.3f ns/hand (+/- %.3f, min %.3f) checksum %lu\n",
+                       engine, workload, n, result->mean, result->stddev, result->min,
+                       result->checksum);
+        }
+        fflush(stdout);
+}
+
+void usage(const char *program) {
+        fprintf(stderr,
+                "usage: %s [--format text|json] [--engine name] [--workload name] [--hands n]\n"
+                "          [--repetitions n] [--exhaustive]\n"
+                "  engines: branchy, hash, batch-scalar, batch-avx2, batch-avx512 (default all)\n"
+                "  workloads: sequential, random, flush, pair, dealer (default all)\n"
+                "  --exhaustive also times enumerating and scoring all 133,784,560 hands\n"
+                "  UTX_ISA=x86-64|x86-64-v2|x86-64-v3|x86-64-v4 in the environment picks the\n"
+                "  instruction set level of the per-hand engines and enumeration, instead of the\n"
+                "  best one the CPU has\n",
+                program);
+}
+
+/**
+ * Returns the index of `name` in `names`, or `count` if it isn't there
+ */
+int find_name(const char *name, const char **names, int count) {
+        for (int i = 0; i < count; i += 1) {
+                if (strcmp(name, names[i]) == 0) {
+                        return i;
+                }
+        }
+        return count;
+}
+
+int main(int argc, char **argv) {
+        bool json = false;
+        bool exhaustive = false;
+        int only_engine = NUM_BENCH_ENGINES;
+        int only_workload = NUM_WORKLOADS;
+        uint64_t n = 1 << 22;
+        uint32_t repetitions = 5;
+
+        for (int i = 1; i < argc; i += 1) {
+                if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+                        json = strcmp(argv[++i], "json") == 0;
+                } else if (strcmp(argv[i], "--engine") == 0 && i + 1 < argc) {
+                        only_engine = find_name(argv[++i], BENCH_ENGINE_NAMES, NUM_BENCH_ENGINES);
+                        if (only_engine == NUM_BENCH_ENGINES) {
+                                usage(argv[0]);
+                                return 1;
                         }
+                } else if (strcmp(argv[i], "--workload") == 0 && i + 1 < argc) {
+                        only_workload = find_name(argv[++i], WORKLOAD_NAMES, NUM_WORKLOADS);
+                        if (only_workload == NUM_WORKLOADS) {
+                                usage(argv[0]);
+                                return 1;
+                        }
+                } else if (strcmp(argv[i], "--hands") == 0 && i + 1 < argc) {
+                        n = strtoull(argv[++i], NULL, 10);
+                } else if (strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc) {
+                        repetitions = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "--exhaustive") == 0) {
+                        exhaustive = true;
+                } else {
+                        usage(argv[0]);
+                        return 1;
                 }
         }
-        clock_t end = clock();
-        clock_t ms = 1000 * (end - begin) / CLOCKS_PER_SEC;
-        printf("Time to enumerate all %d possible hands: %ldms\n", count, ms);
-
-        count = 0;
-        begin = clock();
-        for (int c1 = 0; c1 < 52 - 6; c1 += 1) {
-                for (int c2 = c1 + 1; c2 < 52 - 5; c2 += 1) {
-                        for (int c3 = c2 + 1; c3 < 52 - 4; c3 += 1) {
-                                for (int c4 = c3 + 1; c4 < 52 - 3; c4 += 1) {
-                                        for (int c5 = c4 + 1; c5 < 52 - 2; c5 += 1) {
-                                                for (int c6 = c5 + 1; c6 < 52 - 1; c6 += 1) {
-                                                        for (int c7 = c6 + 1; c7 < 52; c7 += 1) {
-                                                                uint64_t hand =
-                                                                    cards[c1] | cards[c2] |
-                                                                    cards[c3] | cards[c4] |
-                                                                    cards[c5] | cards[c6] |
-                                                                    cards[c7];
-                                                                eval_hand(hand);
-                                                                count += 1;
-                                                        }
-                                                }
-                                        }
-                                }
+        if (n < 1 || repetitions < 1) {
+                usage(argv[0]);
+                return 1;
+        }
+
+        if (!init_engine(ENGINE_BRANCHY) || !init_default_hash_eval()) {
+                return 1;
+        }
+
+        uint64_t *hands = malloc(n * sizeof(uint64_t));
+        if (!hands) {
+                fprintf(stderr, "Could not allocate %lu hands\n", n);
+                return 1;
+        }
+
+        if (json) {
+                printf("{\n  \"build\": \"%s\",\n  \"isa\": \"%s\",\n  \"repetitions\": %u,\n"
+                       "  \"results\": [",
+                       BENCH_BUILD, ISA_NAMES[selected_isa], repetitions);
+        } else {
+                printf("build %s, isa %s, %u repetitions after a warmup\n", BENCH_BUILD,
+                       ISA_NAMES[selected_isa], repetitions);
+        }
+
+        bool first = true;
+        for (int workload = 0; workload < NUM_WORKLOADS; workload += 1) {
+                if (only_workload != NUM_WORKLOADS && workload != only_workload) {
+                        continue;
+                }
+
+                random_state = 0x9E3779B97F4A7C15ULL;
+                build_workload(workload, hands, n);
+                for (int engine = 0; engine < NUM_BENCH_ENGINES; engine += 1) {
+                        if ((only_engine != NUM_BENCH_ENGINES && engine != only_engine) ||
+                            !bench_engine_supported(engine)) {
+                                continue;
                         }
+
+                        struct BenchResult result = benchmark(engine, hands, n, repetitions);
+                        print_result(json, first, BENCH_ENGINE_NAMES[engine],
+                                     WORKLOAD_NAMES[workload], n, &result);
+                        first = false;
+                }
+        }
+
+        if (exhaustive) {
+                // Enumeration alone is reported as its own row rather than subtracted, since the
+                // two overlap once the evaluation is interleaved with it
+                struct BenchResult result = benchmark(NUM_BENCH_ENGINES, NULL, 0, repetitions);
+                print_result(json, first, "none", "exhaustive", ALL_HANDS, &result);
+                first = false;
+
+                for (int engine = 0; engine < NUM_BENCH_ENGINES; engine += 1) {
+                        if ((only_engine != NUM_BENCH_ENGINES && engine != only_engine) ||
+                            !bench_engine_supported(engine)) {
+                                continue;
+                        }
+
+                        result = benchmark(engine, NULL, 0, repetitions);
+                        print_result(json, first, BENCH_ENGINE_NAMES[engine], "exhaustive",
+                                     ALL_HANDS, &result);
                 }
         }
-        end = clock();
-        clock_t diff = 1000 * (end - begin) / CLOCKS_PER_SEC;
-        printf("Time to evaluate all %d possible hands minus loop times: %ldms\n", count,
-               diff - ms);
+
+        if (json) {
+                printf("\n  ]\n}\n");
+        }
+
+        free(hands);
+        return 0;
 }
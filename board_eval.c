@@ -0,0 +1,61 @@
+#pragma once
+
+#include "hash_eval.c"
+
+// Board-conditioned evaluation. Five board cards are analysed once into a BoardState, after which
+// each two-card completion costs two key lookups and two table loads. With five board cards at
+// most one suit can hold three or more of them, so that is the only suit a completion can flush.
+struct BoardState {
+        Card board;
+        // Hash key sum of the board ranks
+        uint32_t key;
+        // Rank mask of each suit, and how many board cards it holds
+        uint16_t suits[4];
+        uint8_t suit_counts[4];
+        // Offset of the only suit that can still flush, and the board's cards in it. When no suit
+        // can flush, flush_hole_mask is 0 so completions look up the empty (non-flush) mask.
+        uint32_t flush_offset;
+        uint64_t flush_cards;
+        uint64_t flush_hole_mask;
+};
+
+void board_eval_init(struct BoardState *state, Card board) {
+        state->board = board;
+        state->key = 0;
+        state->flush_offset = 0;
+        state->flush_cards = 0;
+        state->flush_hole_mask = 0;
+
+        for (uint32_t suit = 0; suit < 4; suit += 1) {
+                uint64_t mask = (board >> (16 * suit)) & RANK_MASK;
+                state->suits[suit] = mask;
+                state->suit_counts[suit] = count_bits(mask);
+                state->key += hash_eval_table->rank_keys[mask];
+
+                if (state->suit_counts[suit] >= 3) {
+                        state->flush_offset = 16 * suit;
+                        state->flush_cards = mask;
+                        state->flush_hole_mask = RANK_MASK;
+                }
+        }
+}
+
+/**
+ * Scores the board plus two hole cards, with the same result as eval_hand(board | hole).
+ * Requires init_hash_eval.
+ */
+uint32_t board_eval_finish(const struct BoardState *state, Card hole) {
+        const struct HashEvalTable *t = hash_eval_table;
+        uint32_t first = __builtin_ctzll(hole);
+        uint32_t second = __builtin_ctzll(hole & (hole - 1));
+
+        uint32_t key = state->key + HASH_RANK_KEYS[first % 16] + HASH_RANK_KEYS[second % 16];
+        uint64_t flush =
+            state->flush_cards | ((hole >> state->flush_offset) & state->flush_hole_mask);
+
+        uint32_t score = t->rank_scores[key];
+        uint32_t flush_score = t->flush_scores[flush];
+        STATS_ADD(board_evals, 1);
+        STATS_ADD(board_eval_flushes, flush_score < score);
+        return flush_score < score ? flush_score : score;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "eval.c"
+
+// Suit isomorphism. Relabelling suits doesn't change any score, so two boards that differ only by
+// a suit permutation which leaves the hole cards in place have identical outcomes. The canonical
+// board of such a class is its numerically smallest member, and its weight is the class size.
+
+#define NUM_SUIT_PERMUTATIONS 24
+
+struct SuitSymmetry {
+        // The permutations fixing the hole cards, as the destination suit of each source suit.
+        // The identity is always first.
+        uint32_t count;
+        uint8_t permutations[NUM_SUIT_PERMUTATIONS][4];
+};
+
+Card permute_suits(Card cards, const uint8_t permutation[4]) {
+        return (((cards >> SPADE_OFFSET) & SPADE_BITMASK) << (16 * permutation[0])) |
+               (((cards >> HEART_OFFSET) & SPADE_BITMASK) << (16 * permutation[1])) |
+               (((cards >> DIAMOND_OFFSET) & SPADE_BITMASK) << (16 * permutation[2])) |
+               (((cards >> CLUB_OFFSET) & SPADE_BITMASK) << (16 * permutation[3]));
+}
+
+/**
+ * Collects the suit permutations that map `hole` onto itself
+ */
+void init_suit_symmetry(struct SuitSymmetry *symmetry, Card hole) {
+        symmetry->count = 0;
+
+        for (uint8_t a = 0; a < 4; a += 1) {
+                for (uint8_t b = 0; b < 4; b += 1) {
+                        for (uint8_t c = 0; c < 4; c += 1) {
+                                if (a == b || a == c || b == c) {
+                                        continue;
+                                }
+
+                                uint8_t permutation[4] = {a, b, c, 6 - a - b - c};
+                                if (permute_suits(hole, permutation) == hole) {
+                                        memcpy(symmetry->permutations[symmetry->count],
+                                               permutation, 4);
+                                        symmetry->count += 1;
+                                }
+                        }
+                }
+        }
+}
+
+/**
+ * Returns the canonical member of the class of `cards`, storing the class size in `weight`
+ */
+Card canonical_cards(const struct SuitSymmetry *symmetry, Card cards, uint32_t *weight) {
+        Card canonical = cards;
+        uint32_t stabilizer = 0;
+
+        for (uint32_t i = 0; i < symmetry->count; i += 1) {
+                Card permuted = permute_suits(cards, symmetry->permutations[i]);
+                if (permuted < canonical) {
+                        canonical = permuted;
+                }
+                if (permuted == cards) {
+                        stabilizer += 1;
+                }
+        }
+
+        *weight = symmetry->count / stabilizer;
+        return canonical;
+}
+
+/**
+ * Returns the class size of `cards` if it is canonical, or 0 if it isn't
+ */
+uint32_t canonical_weight(const struct SuitSymmetry *symmetry, Card cards) {
+        uint32_t weight;
+        return canonical_cards(symmetry, cards, &weight) == cards ? weight : 0;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "stats.c"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+// Combinations of cards over the 64-bit Card layout. Walking k-subsets of a set of live bits in
+// increasing numeric order is colexicographic order over those bits, so the i-th subset can be
+// reached directly with the combinatorial number system instead of i calls to next_combination.
+//
+// The live cards are sparse in the Card layout (16 bits a suit, 3 of them unused, plus whatever
+// cards are dealt), so CombinationIterator walks subsets in a dense index space instead, where
+// the n live cards are bits 0..n-1 and every step is a valid subset. pext packs cards into that
+// space and pdep spreads them back; without BMI2, portable loops do the same.
+
+#define MAX_COMBINATION_BITS 64
+#define MAX_COMBINATION_SIZE 8
+
+// All 52 cards, without the deadzones
+#define FULL_DECK 0x1FFF1FFF1FFF1FFFull
+
+// n choose k, generated into tables.h by gen_tables.c with compute_binomials
+#ifndef GENERATING_TABLES
+#include "tables.h"
+#else
+const uint64_t binomial_table[MAX_COMBINATION_BITS + 1][MAX_COMBINATION_SIZE + 1];
+#endif
+
+/**
+ * Builds binomial_table the slow way, from Pascal's triangle
+ */
+void compute_binomials(uint64_t table[MAX_COMBINATION_BITS + 1][MAX_COMBINATION_SIZE + 1]) {
+        for (uint32_t n = 0; n <= MAX_COMBINATION_BITS; n += 1) {
+                table[n][0] = 1;
+                for (uint32_t k = 1; k <= MAX_COMBINATION_SIZE; k += 1) {
+                        table[n][k] = n == 0 ? 0 : table[n - 1][k - 1] + table[n - 1][k];
+                }
+        }
+}
+
+// https://stackoverflow.com/questions/506807/creating-multiple-numbers-with-certain-number-of-bits-set
+uint64_t next_combination(uint64_t x, uint64_t deadzones) {
+        STATS_ADD(combinations, 1);
+        do {
+                uint64_t smallest = (x & -x);
+                uint64_t ripple = x + smallest;
+                uint64_t new_smallest = ripple & -ripple;
+                x = ripple | ((new_smallest / smallest) >> 1) - 1;
+                STATS_ADD(combination_skips, (x & deadzones) != 0);
+        } while (x & deadzones);
+
+        return x;
+}
+
+/**
+ * Returns the n-th (0-based) lowest set bit of mask
+ */
+uint64_t nth_set_bit(uint64_t mask, uint32_t n) {
+        for (uint32_t i = 0; i < n; i += 1) {
+                mask &= mask - 1;
+        }
+
+        return mask & -mask;
+}
+
+/**
+ * Returns the index-th k-subset of the low `n` bits, in increasing numeric order
+ */
+uint64_t nth_dense_combination(uint64_t index, uint32_t k, uint32_t n) {
+        uint64_t result = 0;
+        uint32_t position = n;
+
+        for (uint32_t j = k; j > 0; j -= 1) {
+                // Largest position whose binomial still fits in what is left of the index
+                do {
+                        position -= 1;
+                } while (binomial_table[position][j] > index);
+
+                index -= binomial_table[position][j];
+                result |= 1ull << position;
+        }
+
+        return result;
+}
+
+struct CombinationIterator {
+        // The current subset, as cards and in the dense index space of `live`
+        Card cards;
+        uint64_t dense;
+        Card live;
+        // One past the last dense subset
+        uint64_t end;
+        // Each live card by its dense index, so a step costs one load per card instead of a
+        // card_pdep loop over every live card. Unused by copies built with BMI2.
+        Card live_cards[MAX_COMBINATION_BITS];
+};
+
+// The default copy of the iterator; dispatch.c builds one more per instruction set level
+#define KERNEL(name) name
+#include "iterator.c"
+#undef KERNEL
+
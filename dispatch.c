@@ -0,0 +1,74 @@
+#pragma once
+
+#include "board_eval.c"
+#include "combination.c"
+#include "isa.c"
+
+// Builds the kernels of kernels.c, and the combination iterator they step with, once for every
+// instruction set level in isa.c, and routes calls to the selected level's copies. Each level is
+// a list of features rather than an arch, so the default-target code the kernels call can still
+// be inlined into them.
+
+// How one player hand fares against every dealer hole on a board
+struct DealerCounts {
+        uint32_t wins_qualified;
+        uint32_t wins_unqualified;
+        uint32_t losses;
+};
+
+#define KERNEL(name) name##_x86_64
+#include "iterator.c"
+#include "kernels.c"
+#undef KERNEL
+
+#pragma GCC push_options
+#pragma GCC target("popcnt,sse4.2")
+#define KERNEL(name) name##_x86_64_v2
+#include "iterator.c"
+#include "kernels.c"
+#undef KERNEL
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("popcnt,sse4.2,avx2,fma,bmi,bmi2,lzcnt,movbe")
+#define KERNEL(name) name##_x86_64_v3
+#include "iterator.c"
+#include "kernels.c"
+#undef KERNEL
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("popcnt,sse4.2,avx2,fma,bmi,bmi2,lzcnt,movbe,avx512f,avx512bw,avx512cd," \
+                   "avx512dq,avx512vl")
+#define KERNEL(name) name##_x86_64_v4
+#include "iterator.c"
+#include "kernels.c"
+#undef KERNEL
+#pragma GCC pop_options
+
+struct Kernels {
+        struct DealerCounts (*score_dealers)(const struct BoardState *state, Card live,
+                                             uint32_t player_score);
+        void (*enumerate_combinations)(uint32_t k, Card live, uint64_t index, Card *cards,
+                                       uint64_t count);
+        uint32_t (*eval_hand)(Card hand);
+        uint32_t (*eval_hand_hash)(Card hand);
+        uint64_t (*nth_combination)(uint64_t index, uint32_t k, uint64_t live);
+        uint64_t (*combination_index)(uint64_t combination, uint64_t live);
+};
+
+#define ISA_KERNELS(suffix)                                                                        \
+        {score_dealers##suffix, enumerate_combinations##suffix, eval_hand##suffix,                 \
+         eval_hand_hash##suffix, nth_combination##suffix, combination_index##suffix}
+
+const struct Kernels KERNELS[NUM_ISAS] = {
+    ISA_KERNELS(_x86_64),
+    ISA_KERNELS(_x86_64_v2),
+    ISA_KERNELS(_x86_64_v3),
+    ISA_KERNELS(_x86_64_v4),
+};
+
+// The selected level's kernels; set by init_kernels
+const struct Kernels *kernels = &KERNELS[ISA_X86_64];
+
+void init_kernels() { kernels = &KERNELS[init_isa()]; }
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "dispatch.c"
+#include "hash_eval.c"
+
+// Both evaluators return the same 0..7461 scores, so callers can switch between them freely
+enum EvalEngine { ENGINE_BRANCHY, ENGINE_HASH, NUM_ENGINES };
+
+const char *ENGINE_NAMES[NUM_ENGINES] = {"branchy", "hash"};
+// Replaced by the selected instruction set level's copies in init_engine
+uint32_t (*engine_functions[NUM_ENGINES])(Card) = {eval_hand, eval_hand_hash};
+
+// The selected evaluator; set by init_engine
+uint32_t (*evaluate)(Card hand) = eval_hand;
+
+/**
+ * Returns the engine with the given name, or NUM_ENGINES if there is none
+ */
+enum EvalEngine parse_engine(const char *name) {
+        for (int i = 0; i < NUM_ENGINES; i += 1) {
+                if (strcmp(name, ENGINE_NAMES[i]) == 0) {
+                        return i;
+                }
+        }
+
+        return NUM_ENGINES;
+}
+
+/**
+ * Initializes the tables `engine` needs and makes it the target of evaluate()
+ */
+bool init_engine(enum EvalEngine engine) {
+        init_kernels();
+        engine_functions[ENGINE_BRANCHY] = kernels->eval_hand;
+        engine_functions[ENGINE_HASH] = kernels->eval_hand_hash;
+
+        if (engine == ENGINE_HASH && !init_default_hash_eval()) {
+                return false;
+        }
+
+        evaluate = engine_functions[engine];
+        return true;
+}
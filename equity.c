@@ -0,0 +1,474 @@
+#pragma once
+
+#include "board_eval.c"
+#include "combination.c"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+// Exhaustive hold'em equity between two weighted ranges on a partial board. Every runout of the
+// live cards is dealt once; each runout's board is analysed once with board_eval_init, and every
+// combo of both ranges is scored against it once. Both ranges are then sorted by score and swept
+// together, so each combo of the first range is counted against all the second range's combos
+// that beat, tie or lose to it at once. Combos sharing a card with it are taken back out through
+// per-card weight totals, so the sweep costs O(|A| + |B|) a runout rather than O(|A| * |B|).
+//
+// Runouts are split into fixed-size chunks that threads take in turn, and chunk results are
+// summed in chunk order, so results don't depend on the number of threads.
+
+#define MAX_RANGE_COMBOS 1326
+// Sort keys hold a score above a combo index of this many bits
+#define COMBO_INDEX_BITS 11
+#define EQUITY_CHUNK_SIZE 4096
+
+struct Combo {
+        Card cards;
+        double weight;
+};
+
+struct Range {
+        uint32_t size;
+        struct Combo combos[MAX_RANGE_COMBOS];
+};
+
+// Counts for the first range against the second. With every weight 1 these are exact counts of
+// (runout, combo, combo) matchups.
+struct EquityResult {
+        double wins;
+        double ties;
+        double losses;
+        uint64_t runouts;
+};
+
+/**
+ * Returns the index of a rank character in RANK_CHARS, or -1 if it isn't one
+ */
+int parse_rank(char c) {
+        const char *found = c ? strchr(RANK_CHARS, c) : NULL;
+        return found ? found - RANK_CHARS : -1;
+}
+
+/**
+ * Returns the card for a rank index (0 = deuce) and suit index (0 = spades)
+ */
+Card rank_suit_card(int rank, int suit) { return 1ull << (16 * suit + rank); }
+
+/**
+ * Parses `count` cards written like "AhKd" from `text`. Returns false unless every card is valid
+ * and distinct.
+ */
+bool parse_cards(const char *text, uint32_t count, Card *cards) {
+        *cards = 0;
+        for (uint32_t i = 0; i < count; i += 1) {
+                int rank = parse_rank(text[2 * i]);
+                const char *suit = text[2 * i + 1] ? strchr(SUIT_CHARS, text[2 * i + 1]) : NULL;
+                if (rank < 0 || !suit) {
+                        return false;
+                }
+
+                Card card = rank_suit_card(rank, suit - SUIT_CHARS);
+                if (*cards & card) {
+                        return false;
+                }
+                *cards |= card;
+        }
+        return true;
+}
+
+/**
+ * Adds one combo to the range, replacing the weight of an existing one
+ */
+void range_add(struct Range *range, Card cards, double weight) {
+        for (uint32_t i = 0; i < range->size; i += 1) {
+                if (range->combos[i].cards == cards) {
+                        range->combos[i].weight = weight;
+                        return;
+                }
+        }
+        range->combos[range->size++] = (struct Combo){cards, weight};
+}
+
+/**
+ * Adds every combo of a starting hand: `kind` is 's' for suited, 'o' for offsuit, or 0 for both
+ */
+void range_add_starting_hand(struct Range *range, int high, int low, char kind, double weight) {
+        for (int s1 = 0; s1 < 4; s1 += 1) {
+                for (int s2 = 0; s2 < 4; s2 += 1) {
+                        bool suited = s1 == s2;
+                        if ((high == low && s2 <= s1) || (kind == 's' && !suited) ||
+                            (kind == 'o' && suited)) {
+                                continue;
+                        }
+                        range_add(range, rank_suit_card(high, s1) | rank_suit_card(low, s2),
+                                  weight);
+                }
+        }
+}
+
+/**
+ * Parses a starting hand like "AK", "AKs" or "TT" into ranks, highest first, and kind. Returns
+ * the number of characters used, or 0 if there isn't one.
+ */
+int parse_hand_class(const char *text, int *high, int *low, char *kind) {
+        *high = parse_rank(text[0]);
+        *low = *high < 0 ? -1 : parse_rank(text[1]);
+        if (*low < 0) {
+                return 0;
+        }
+        if (*low > *high) {
+                int swap = *low;
+                *low = *high;
+                *high = swap;
+        }
+
+        *kind = text[2] == 's' || text[2] == 'o' ? text[2] : 0;
+        if (*kind && *high == *low) {
+                return 0;
+        }
+        return *kind ? 3 : 2;
+}
+
+/**
+ * Adds one range item: a combo like "AhKd", a starting hand like "AKs", "AK" or "TT", a "+" form
+ * like "TT+" or "ATs+" (raising the lower rank), or a span like "22-55" or "A2s-A5s".
+ */
+bool range_add_item(struct Range *range, const char *item, double weight) {
+        Card cards;
+        if (strlen(item) == 4 && parse_cards(item, 2, &cards)) {
+                range_add(range, cards, weight);
+                return true;
+        }
+
+        int high, low, last_high, last_low;
+        char kind, last_kind;
+        int length = parse_hand_class(item, &high, &low, &kind);
+        if (!length) {
+                return false;
+        }
+
+        const char *rest = item + length;
+        if (*rest == '\0') {
+                last_high = high;
+                last_low = low;
+        } else if (strcmp(rest, "+") == 0) {
+                last_high = high == low ? 12 : high;
+                last_low = high == low ? 12 : high - 1;
+        } else if (rest[0] == '-' && parse_hand_class(rest + 1, &last_high, &last_low,
+                                                      &last_kind) == (int)strlen(rest + 1) &&
+                   last_kind == kind) {
+                // Spans may be written from either end
+                if (last_low < low) {
+                        int swap_high = high, swap_low = low;
+                        high = last_high;
+                        low = last_low;
+                        last_high = swap_high;
+                        last_low = swap_low;
+                }
+        } else {
+                return false;
+        }
+
+        bool pairs = high == low;
+        if ((pairs != (last_high == last_low)) || (!pairs && last_high != high) ||
+            last_low < low) {
+                return false;
+        }
+        for (int rank = low; rank <= last_low; rank += 1) {
+                range_add_starting_hand(range, pairs ? rank : high, rank, kind, weight);
+        }
+        return true;
+}
+
+/**
+ * Parses a range like "AKs, TT+, A5s-A2s, KhQh:0.5" into `range`. Items are separated by commas
+ * or spaces, and may carry a ":weight" suffix (default 1). Returns false on the first invalid
+ * item.
+ */
+bool parse_range(const char *text, struct Range *range) {
+        range->size = 0;
+        char item[32];
+
+        while (*text) {
+                size_t length = strcspn(text, ", ");
+                if (length == 0) {
+                        text += 1;
+                        continue;
+                }
+                if (length >= sizeof(item)) {
+                        fprintf(stderr, "Invalid range item '%.*s'\n", (int)length, text);
+                        return false;
+                }
+
+                memcpy(item, text, length);
+                item[length] = '\0';
+                text += length;
+
+                double weight = 1.0;
+                char *colon = strchr(item, ':');
+                if (colon) {
+                        char *end;
+                        *colon = '\0';
+                        weight = strtod(colon + 1, &end);
+                        if (end == colon + 1 || *end != '\0' || weight < 0.0) {
+                                fprintf(stderr, "Invalid weight in '%s'\n", item);
+                                return false;
+                        }
+                }
+
+                if (!range_add_item(range, item, weight)) {
+                        fprintf(stderr, "Invalid range item '%s'\n", item);
+                        return false;
+                }
+        }
+        return true;
+}
+
+/**
+ * Removes combos that touch `dead` or have no weight
+ */
+void range_remove_dead(struct Range *range, Card dead) {
+        uint32_t size = 0;
+        for (uint32_t i = 0; i < range->size; i += 1) {
+                if (!(range->combos[i].cards & dead) && range->combos[i].weight > 0.0) {
+                        range->combos[size++] = range->combos[i];
+                }
+        }
+        range->size = size;
+}
+
+struct EquityJob {
+        const struct Range *ranges[2];
+        Card board;
+        Card live;
+        uint32_t runout_cards;
+        uint64_t runouts;
+        uint32_t num_chunks;
+        uint32_t next_chunk;
+        struct EquityResult *chunk_results;
+        // For each combo of the first range, the weight of the same two cards in the second
+        double same_combo_weights[MAX_RANGE_COMBOS];
+};
+
+/**
+ * Sorts `count` keys, each a score above a COMBO_INDEX_BITS combo index, by score with two radix
+ * passes of 7 bits. Scores are below 2^13, so the second pass only uses 64 of its buckets.
+ */
+void sort_score_keys(uint32_t *keys, uint32_t *scratch, uint32_t count) {
+        for (uint32_t shift = COMBO_INDEX_BITS; shift < COMBO_INDEX_BITS + 14; shift += 7) {
+                uint32_t offsets[128] = {0};
+                for (uint32_t i = 0; i < count; i += 1) {
+                        offsets[(keys[i] >> shift) & 127] += 1;
+                }
+                uint32_t total = 0;
+                for (uint32_t bucket = 0; bucket < 128; bucket += 1) {
+                        uint32_t size = offsets[bucket];
+                        offsets[bucket] = total;
+                        total += size;
+                }
+                for (uint32_t i = 0; i < count; i += 1) {
+                        scratch[offsets[(keys[i] >> shift) & 127]++] = keys[i];
+                }
+                memcpy(keys, scratch, count * sizeof(uint32_t));
+        }
+}
+
+/**
+ * Scores every combo of `range` that misses `board` and returns how many there are. Their sort
+ * keys go in `keys`, sorted best first.
+ */
+uint32_t score_range(const struct Range *range, const struct BoardState *state, Card board,
+                     uint32_t *keys, uint32_t *scratch) {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < range->size; i += 1) {
+                Card cards = range->combos[i].cards;
+                if (!(cards & board)) {
+                        keys[count++] = board_eval_finish(state, cards) << COMBO_INDEX_BITS | i;
+                }
+        }
+        sort_score_keys(keys, scratch, count);
+        return count;
+}
+
+// Weight of a set of the second range's combos: in total, and of those holding each card
+struct ComboWeights {
+        double total;
+        double cards[64];
+};
+
+void combo_weights_add(struct ComboWeights *weights, Card cards, double weight) {
+        weights->total += weight;
+        weights->cards[__builtin_ctzll(cards)] += weight;
+        weights->cards[63 - __builtin_clzll(cards)] += weight;
+}
+
+/**
+ * Returns the weight of the combos in `weights` that share no card with `cards`, counting the
+ * combo of exactly `cards`, of weight `same`, as sharing cards only once
+ */
+double combo_weights_without(const struct ComboWeights *weights, Card cards, double same) {
+        return weights->total - weights->cards[__builtin_ctzll(cards)] -
+               weights->cards[63 - __builtin_clzll(cards)] + same;
+}
+
+/**
+ * Adds the matchups of every runout in one chunk to its result
+ */
+void equity_chunk(struct EquityJob *job, uint32_t chunk) {
+        const struct Range *a = job->ranges[0];
+        const struct Range *b = job->ranges[1];
+        struct EquityResult *result = &job->chunk_results[chunk];
+        uint32_t a_keys[MAX_RANGE_COMBOS], b_keys[MAX_RANGE_COMBOS], scratch[MAX_RANGE_COMBOS];
+        const uint32_t index_mask = (1u << COMBO_INDEX_BITS) - 1;
+
+        uint64_t first = (uint64_t)chunk * EQUITY_CHUNK_SIZE;
+        uint64_t count = job->runouts - first < EQUITY_CHUNK_SIZE ? job->runouts - first
+                                                                  : EQUITY_CHUNK_SIZE;
+        struct CombinationIterator runouts;
+        combinations_start(&runouts, job->runout_cards, job->live, first);
+
+        memset(result, 0, sizeof(*result));
+        for (uint64_t i = 0; i < count; i += 1, combinations_next(&runouts)) {
+                Card board = job->board | runouts.cards;
+                struct BoardState state;
+                board_eval_init(&state, board);
+                uint32_t a_size = score_range(a, &state, board, a_keys, scratch);
+                uint32_t b_size = score_range(b, &state, board, b_keys, scratch);
+
+                // The second range's combos in all, scoring better than the current combo of the
+                // first, and scoring no worse than it. The sweep only ever adds to the last two.
+                struct ComboWeights all = {0}, better = {0}, no_worse = {0};
+                for (uint32_t y = 0; y < b_size; y += 1) {
+                        const struct Combo *combo = &b->combos[b_keys[y] & index_mask];
+                        combo_weights_add(&all, combo->cards, combo->weight);
+                }
+
+                uint32_t next_better = 0, next_no_worse = 0;
+                for (uint32_t x = 0; x < a_size; x += 1) {
+                        uint32_t score = a_keys[x] >> COMBO_INDEX_BITS;
+                        for (; next_better < b_size &&
+                               b_keys[next_better] >> COMBO_INDEX_BITS < score;
+                             next_better += 1) {
+                                const struct Combo *combo = &b->combos[b_keys[next_better] &
+                                                                       index_mask];
+                                combo_weights_add(&better, combo->cards, combo->weight);
+                        }
+                        for (; next_no_worse < b_size &&
+                               b_keys[next_no_worse] >> COMBO_INDEX_BITS <= score;
+                             next_no_worse += 1) {
+                                const struct Combo *combo = &b->combos[b_keys[next_no_worse] &
+                                                                       index_mask];
+                                combo_weights_add(&no_worse, combo->cards, combo->weight);
+                        }
+
+                        // The second range's copy of these cards scores the same, so it is only
+                        // counted among the ties
+                        uint32_t index = a_keys[x] & index_mask;
+                        Card cards = a->combos[index].cards;
+                        double same = job->same_combo_weights[index];
+                        double losses = combo_weights_without(&better, cards, 0.0);
+                        double ties = combo_weights_without(&no_worse, cards, same) - losses;
+                        double wins = combo_weights_without(&all, cards, same) - losses - ties;
+
+                        double weight = a->combos[index].weight;
+                        result->wins += weight * wins;
+                        result->ties += weight * ties;
+                        result->losses += weight * losses;
+                }
+        }
+        result->runouts = count;
+}
+
+void *equity_worker(void *arg) {
+        struct EquityJob *job = arg;
+
+        for (;;) {
+                uint32_t chunk = __atomic_fetch_add(&job->next_chunk, 1, __ATOMIC_RELAXED);
+                if (chunk >= job->num_chunks) {
+                        STATS_MERGE_THREAD();
+                        return NULL;
+                }
+
+                equity_chunk(job, chunk);
+        }
+}
+
+/**
+ * Computes the equity of range `a` against range `b` by dealing every runout of `board` (0 to 5
+ * cards) that avoids `dead`, on `threads` threads. Combos touching the board or dead cards are
+ * dropped from the ranges. Requires init_engine(ENGINE_HASH). Returns false if the board is too
+ * big or the result tables can't be allocated.
+ */
+bool compute_equity(struct Range *a, struct Range *b, Card board, Card dead, uint32_t threads,
+                    struct EquityResult *result) {
+        uint32_t board_cards = __builtin_popcountll(board);
+        if (board_cards > 5) {
+                fprintf(stderr, "A board has at most 5 cards\n");
+                return false;
+        }
+
+        range_remove_dead(a, board | dead);
+        range_remove_dead(b, board | dead);
+        memset(result, 0, sizeof(*result));
+        if (a->size == 0 || b->size == 0) {
+                return true;
+        }
+
+        // A card every combo of a range holds can't come on the board
+        Card held[2] = {~0ull, ~0ull};
+        const struct Range *ranges[2] = {a, b};
+        for (int r = 0; r < 2; r += 1) {
+                for (uint32_t i = 0; i < ranges[r]->size; i += 1) {
+                        held[r] &= ranges[r]->combos[i].cards;
+                }
+        }
+
+        struct EquityJob job = {
+            .ranges = {a, b},
+            .board = board,
+            .live = FULL_DECK & ~(board | dead | held[0] | held[1]),
+            .runout_cards = 5 - board_cards,
+        };
+        for (uint32_t x = 0; x < a->size; x += 1) {
+                for (uint32_t y = 0; y < b->size; y += 1) {
+                        if (b->combos[y].cards == a->combos[x].cards) {
+                                job.same_combo_weights[x] = b->combos[y].weight;
+                        }
+                }
+        }
+        job.runouts = binomial_table[__builtin_popcountll(job.live)][job.runout_cards];
+        job.num_chunks = (job.runouts + EQUITY_CHUNK_SIZE - 1) / EQUITY_CHUNK_SIZE;
+        job.chunk_results = malloc(job.num_chunks * sizeof(struct EquityResult));
+        if (!job.chunk_results) {
+                fprintf(stderr, "Could not allocate equity results\n");
+                return false;
+        }
+
+        pthread_t workers[threads > 1 ? threads - 1 : 1];
+        uint32_t spawned = 0;
+        while (spawned + 1 < threads &&
+               pthread_create(&workers[spawned], NULL, equity_worker, &job) == 0) {
+                spawned += 1;
+        }
+        equity_worker(&job);
+        for (uint32_t t = 0; t < spawned; t += 1) {
+                pthread_join(workers[t], NULL);
+        }
+
+        for (uint32_t chunk = 0; chunk < job.num_chunks; chunk += 1) {
+                result->wins += job.chunk_results[chunk].wins;
+                result->ties += job.chunk_results[chunk].ties;
+                result->losses += job.chunk_results[chunk].losses;
+                result->runouts += job.chunk_results[chunk].runouts;
+        }
+
+        free(job.chunk_results);
+        return true;
+}
+
+/**
+ * Returns the share of the pot the first range wins, counting ties as half
+ */
+double equity_share(const struct EquityResult *result) {
+        double total = result->wins + result->ties + result->losses;
+        return total > 0.0 ? (result->wins + result->ties / 2) / total : 0.0;
+}
@@ -1,3 +1,7 @@
+#pragma once
+
+#include "stats.c"
+
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -5,6 +9,9 @@
 
 typedef uint64_t Card;
 
+// Bump whenever the scores eval_hand returns change, so cached tables built from them are rebuilt
+const uint32_t EVAL_VERSION = 2;
+
 enum Cards { NULL_CARD };
 const uint64_t SPADE_OFFSET = 0;
 const uint64_t HEART_OFFSET = 16;
@@ -53,7 +60,33 @@ const uint32_t TWO_PAIR_INDEX = TRIPS_INDEX + NUM_TRIPS;
 const uint32_t PAIR_INDEX = TWO_PAIR_INDEX + NUM_TWO_PAIRS;
 const uint32_t HIGH_CARD_INDEX = PAIR_INDEX + NUM_PAIRS;
 
-uint64_t unique_five_lookup_table[NUM_HIGH_CARD_HANDS];
+// Every 13-bit rank mask, used to index the direct lookup tables below
+#define NUM_RANK_MASKS 8192
+#define RANK_MASK 0x1FFF
+
+// The rank masks of the five-card high card hands that aren't straights, in increasing order, and
+// the rank-mask indexed tables built from them. Entries that can't be scored as the given category
+// hold UINT16_MAX (or 0 for straight_rank_table). gen_tables.c writes them into tables.h with
+// compute_rank_tables, so they are read-only data shared by every process and need no
+// initialization; gen_tables.c itself builds with empty placeholders.
+#ifndef GENERATING_TABLES
+#include "tables.h"
+#else
+const uint64_t unique_five_lookup_table[NUM_HIGH_CARD_HANDS];
+const uint16_t top_five_table[NUM_RANK_MASKS];
+const uint16_t flush_rank_table[NUM_RANK_MASKS];
+const uint16_t high_card_rank_table[NUM_RANK_MASKS];
+const uint8_t straight_rank_table[NUM_RANK_MASKS];
+#endif
+
+// The same tables, as compute_rank_tables builds them
+struct RankTables {
+        uint64_t unique_fives[NUM_HIGH_CARD_HANDS];
+        uint16_t top_fives[NUM_RANK_MASKS];
+        uint16_t flush_ranks[NUM_RANK_MASKS];
+        uint16_t high_card_ranks[NUM_RANK_MASKS];
+        uint8_t straight_ranks[NUM_RANK_MASKS];
+};
 
 Card create_card(const char *representation) {
         if (strnlen(representation, 3) != 2) {
@@ -134,15 +167,39 @@ uint32_t card_index(uint64_t card) {
         return index - 3 * (index / 16);
 }
 
+const char RANK_CHARS[] = "23456789TJQKA";
+const char SUIT_CHARS[] = "shdc";
+
 /**
- * Returns the number of bits set, for at most 14-bit values
+ * Writes `cards` as two characters per card ("AhKd"), lowest bit first, into `out`, which must
+ * hold 2 * popcount(cards) + 1 bytes
  */
-uint32_t count_bits(uint64_t n) { return (n * 0x200040008001ULL & 0x111111111111111ULL) % 0xf; }
+void format_cards(Card cards, char *out) {
+        for (; cards; cards &= cards - 1) {
+                uint32_t bit = __builtin_ctzll(cards);
+                *out++ = RANK_CHARS[bit % 16];
+                *out++ = SUIT_CHARS[bit / 16];
+        }
+        *out = '\0';
+}
 
 /**
- * Returns the rank of the straight, or 0 if none
+ * Returns the number of bits set. GCC recognizes this as a popcount, so every instruction set
+ * level copy it is inlined into gets hardware popcount when the level has it, while the baseline
+ * keeps this inline instead of calling libgcc's __popcountdi2.
  */
-uint32_t straight_rank(uint64_t hand) {
+uint32_t count_bits(uint64_t n) {
+        n = n - ((n >> 1) & 0x5555555555555555ULL);
+        n = (n & 0x3333333333333333ULL) + ((n >> 2) & 0x3333333333333333ULL);
+        n = (n + (n >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return (n * 0x0101010101010101ULL) >> 56;
+}
+
+/**
+ * Returns the rank of the straight, or 0 if none. Walks the bits directly, so it is only used to
+ * build straight_rank_table.
+ */
+uint32_t compute_straight_rank(uint64_t hand) {
         const uint64_t straight_bitmask = 0x1F00;
         uint64_t acc = hand;
 
@@ -164,6 +221,11 @@ uint32_t straight_rank(uint64_t hand) {
         return (hand & 0x100F) == 0x100F ? 5 : 0;
 }
 
+/**
+ * Returns the rank of the straight, or 0 if none
+ */
+uint32_t straight_rank(uint64_t hand) { return straight_rank_table[hand & RANK_MASK]; }
+
 uint64_t get_flushed_cards(uint64_t hand) {
         uint64_t club_bits = (hand & CLUB_BITMASK) >> CLUB_OFFSET;
         uint64_t heart_bits = (hand & HEART_BITMASK) >> HEART_OFFSET;
@@ -201,32 +263,9 @@ uint32_t eval_flush(uint64_t hand) {
                 return UINT32_MAX;
         }
 
-        // Make sure we only have 5 bits set
-        for (uint32_t i = count_bits(flush); i > 5; i -= 1) {
-                // Flip the least significant 1-bit to 0
-                flush = flush ^ (flush & -flush);
-        }
-
-        uint32_t l = 0;
-        uint32_t r = 1277;
-        uint32_t index = UINT32_MAX;
-        while (l != r) {
-                uint32_t mid = (l + r) / 2;
-                if (unique_five_lookup_table[mid] > flush) {
-                        r = mid;
-                } else if (unique_five_lookup_table[mid] < flush) {
-                        l = mid;
-                } else {
-                        index = mid;
-                        break;
-                }
-        }
-
-        if (index != UINT32_MAX) { // found index
-                return FLUSH_INDEX + NUM_FLUSHES - index - 1;
-        } else {
-                return UINT32_MAX;
-        }
+        STATS_ADD(flush_lookups, 1);
+        uint32_t rank = flush_rank_table[flush & RANK_MASK];
+        return rank == UINT16_MAX ? UINT32_MAX : rank;
 }
 
 uint32_t eval_high_card(uint64_t hand) {
@@ -234,31 +273,9 @@ uint32_t eval_high_card(uint64_t hand) {
             ((hand & CLUB_BITMASK) >> CLUB_OFFSET) | ((hand & HEART_BITMASK) >> HEART_OFFSET) |
             ((hand & DIAMOND_BITMASK) >> DIAMOND_OFFSET) | ((hand & SPADE_BITMASK) >> SPADE_OFFSET);
 
-        for (uint32_t i = count_bits(hc); i > 5; i -= 1) {
-                // Flip the least significant 1-bit to 0
-                hc = hc ^ (hc & -hc);
-        }
-
-        uint32_t l = 0;
-        uint32_t r = 1277;
-        uint32_t index = UINT32_MAX;
-        while (l != r) {
-                uint32_t mid = (l + r) / 2;
-                if (unique_five_lookup_table[mid] > hc) {
-                        r = mid;
-                } else if (unique_five_lookup_table[mid] < hc) {
-                        l = mid;
-                } else {
-                        index = mid;
-                        break;
-                }
-        }
-
-        if (index != UINT32_MAX) { // found index
-                return HIGH_CARD_INDEX + NUM_HIGH_CARD_HANDS - index - 1;
-        } else {
-                return UINT32_MAX;
-        }
+        STATS_ADD(high_card_lookups, 1);
+        uint32_t rank = high_card_rank_table[hc & RANK_MASK];
+        return rank == UINT16_MAX ? UINT32_MAX : rank;
 }
 
 uint32_t eval_quads(uint64_t hand, uint64_t c, uint64_t h, uint64_t d, uint64_t s) {
@@ -274,8 +291,15 @@ uint32_t eval_quads(uint64_t hand, uint64_t c, uint64_t h, uint64_t d, uint64_t
 }
 
 uint32_t eval_full_house(uint64_t trips, uint64_t pairs) {
-        if (trips && pairs) {
-                uint32_t trips_rank = 63 - __builtin_clzll(trips);
+        if (!trips) {
+                return UINT32_MAX;
+        }
+
+        // With 7 cards there can be two sets of trips, in which case the lower one is the pair
+        uint32_t trips_rank = 63 - __builtin_clzll(trips);
+        pairs |= trips & ~(1ull << trips_rank);
+
+        if (pairs) {
                 uint32_t pair_rank = 63 - __builtin_clzll(pairs);
                 return FULL_HOUSE_INDEX + (12 - trips_rank) * 12 +
                        ((pair_rank > trips_rank) ? 12 - pair_rank : 11 - pair_rank);
@@ -292,7 +316,7 @@ uint32_t eval_trips(uint64_t trips, uint64_t hand) {
                 uint32_t trips_rank = 63 - __builtin_clzll(trips);
                 uint32_t kicker1 = 63 - __builtin_clzll(kickers);
                 uint32_t k1_adjusted = kicker1 - (kicker1 > trips_rank ? 1 : 0);
-                uint32_t kicker2 = 63 - __builtin_clzll(kickers & ~(1 << kicker1));
+                uint32_t kicker2 = 63 - __builtin_clzll(kickers & ~(1ull << kicker1));
                 uint32_t k2_adjusted = kicker2 - (kicker2 > trips_rank ? 1 : 0);
                 // printf("%d, %d\n", k1_adjusted, k2_adjusted);
                 return TRIPS_INDEX + ((12 - trips_rank) * 66) +
@@ -303,10 +327,10 @@ uint32_t eval_trips(uint64_t trips, uint64_t hand) {
 uint32_t eval_pair(uint64_t pairs, uint64_t hand) {
         // Called after we verified 1 pair
         uint32_t pair = 63 - __builtin_clzll(pairs);
-        hand = hand & ~(1 << pair);
+        hand = hand & ~(1ull << pair);
         uint32_t kicker1 = 63 - __builtin_clzll(hand);
-        uint32_t kicker2 = 63 - __builtin_clzll(hand & ~(1 << kicker1));
-        uint32_t kicker3 = 63 - __builtin_clzll(hand & ~(1 << kicker1) & ~(1 << kicker2));
+        uint32_t kicker2 = 63 - __builtin_clzll(hand & ~(1ull << kicker1));
+        uint32_t kicker3 = 63 - __builtin_clzll(hand & ~(1ull << kicker1) & ~(1ull << kicker2));
         kicker1 -= kicker1 > pair ? 2 : 1;
         kicker2 -= kicker2 > pair ? 1 : 0;
         kicker3 -= kicker3 > pair ? 1 : 0;
@@ -324,9 +348,9 @@ uint32_t eval_pair(uint64_t pairs, uint64_t hand) {
 uint32_t eval_two_pair(uint64_t pairs, uint64_t hand) {
         // Called after we verified 2+ pairs
         uint32_t pair1 = 63 - __builtin_clzll(pairs);
-        pairs = pairs & ~(1 << pair1);
+        pairs = pairs & ~(1ull << pair1);
         uint32_t pair2 = 63 - __builtin_clzll(pairs);
-        uint32_t kicker = 63 - __builtin_clzll(hand & ~(1 << pair1) & ~(1 << pair2));
+        uint32_t kicker = 63 - __builtin_clzll(hand & ~(1ull << pair1) & ~(1ull << pair2));
         kicker -= (kicker > pair2 ? (kicker > pair1 ? 2 : 1) : 0);
 
         return TWO_PAIR_INDEX + NUM_TWO_PAIRS - (pair1 * (pair1 - 1) / 2 * 11) - kicker -
@@ -334,31 +358,14 @@ uint32_t eval_two_pair(uint64_t pairs, uint64_t hand) {
 }
 
 /**
- * Evaluates the value of the best possible 5-card hand given a 7 cards
+ * Scores a hand that can't be a flush from its suit rank masks, by quads down to high card
  */
-uint32_t eval_hand(uint64_t hand) {
-
-        uint32_t straight_flush_eval = eval_straight_flush(hand);
-        if (straight_flush_eval != UINT32_MAX) {
-                return straight_flush_eval;
-        }
-
-        // Does hand contain a flush?
-        uint32_t flush_eval = eval_flush(hand);
-        if (flush_eval != UINT32_MAX) {
-                return flush_eval;
-        }
-
-        // With 7 cards, a flush is mutually exclusive with four of a kind and full house, so we can
-        // check these after
-        uint64_t c = ((hand & CLUB_BITMASK) >> CLUB_OFFSET);
-        uint64_t h = ((hand & HEART_BITMASK) >> HEART_OFFSET);
-        uint64_t d = ((hand & DIAMOND_BITMASK) >> DIAMOND_OFFSET);
-        uint64_t s = ((hand & SPADE_BITMASK) >> SPADE_OFFSET);
+uint32_t eval_ranks(uint64_t c, uint64_t h, uint64_t d, uint64_t s) {
         uint64_t flattened = c | h | d | s;
 
         uint32_t quads_eval = eval_quads(flattened, c, h, d, s);
         if (quads_eval != UINT32_MAX) {
+                STATS_ADD(eval_categories[STATS_QUADS], 1);
                 return quads_eval;
         }
 
@@ -371,46 +378,226 @@ uint32_t eval_hand(uint64_t hand) {
 
         uint32_t full_house_eval = eval_full_house(trips, pairs);
         if (full_house_eval != UINT32_MAX) {
+                STATS_ADD(eval_categories[STATS_FULL_HOUSE], 1);
                 return full_house_eval;
         }
 
         // Next, check for straight
         uint32_t straight_eval = straight_rank(flattened);
         if (straight_eval != 0) {
+                STATS_ADD(eval_categories[STATS_STRAIGHT], 1);
                 return STRAIGHT_INDEX + 14 - straight_eval;
         }
 
         uint32_t trips_eval = eval_trips(trips, flattened);
         if (trips_eval != UINT32_MAX) {
+                STATS_ADD(eval_categories[STATS_TRIPS], 1);
                 return trips_eval;
         }
 
         switch (count_bits(pairs)) {
         case 0:
+                STATS_ADD(eval_categories[STATS_HIGH_CARD], 1);
                 return eval_high_card(flattened);
         case 1:
+                STATS_ADD(eval_categories[STATS_PAIR], 1);
                 return eval_pair(pairs, flattened);
         default:
+                STATS_ADD(eval_categories[STATS_TWO_PAIR], 1);
                 return eval_two_pair(pairs, flattened);
         }
 }
 
+/**
+ * Scores a hand whose cards all have different ranks, given its rank mask and its flushed
+ * suit's rank mask, or 0 if it has none. Only straights, flushes and high cards are possible.
+ */
+uint32_t eval_unpaired(uint64_t ranks, uint64_t flush) {
+        if (flush) {
+                uint32_t straight = straight_rank(flush);
+                STATS_ADD(eval_categories[straight ? STATS_STRAIGHT_FLUSH : STATS_FLUSH], 1);
+                return straight ? STRAIGHT_FLUSH_INDEX + 14 - straight
+                                : flush_rank_table[flush & RANK_MASK];
+        }
+
+        uint32_t straight = straight_rank(ranks);
+        STATS_ADD(eval_categories[straight ? STATS_STRAIGHT : STATS_HIGH_CARD], 1);
+        return straight ? STRAIGHT_INDEX + 14 - straight : high_card_rank_table[ranks & RANK_MASK];
+}
+
+/**
+ * Evaluates the value of the best possible 5-card hand given a 7 cards
+ */
+uint32_t eval_hand(uint64_t hand) {
+
+        uint32_t straight_flush_eval = eval_straight_flush(hand);
+        if (straight_flush_eval != UINT32_MAX) {
+                STATS_ADD(eval_categories[STATS_STRAIGHT_FLUSH], 1);
+                return straight_flush_eval;
+        }
+
+        // Does hand contain a flush?
+        uint32_t flush_eval = eval_flush(hand);
+        if (flush_eval != UINT32_MAX) {
+                STATS_ADD(eval_categories[STATS_FLUSH], 1);
+                return flush_eval;
+        }
+
+        // With 7 cards, a flush is mutually exclusive with four of a kind and full house, so we can
+        // check these after
+        uint64_t c = ((hand & CLUB_BITMASK) >> CLUB_OFFSET);
+        uint64_t h = ((hand & HEART_BITMASK) >> HEART_OFFSET);
+        uint64_t d = ((hand & DIAMOND_BITMASK) >> DIAMOND_OFFSET);
+        uint64_t s = ((hand & SPADE_BITMASK) >> SPADE_OFFSET);
+        return eval_ranks(c, h, d, s);
+}
+
+/**
+ * Scores exactly five cards, with the same result as eval_hand. Half of all five-card hands have
+ * five different ranks, and only need the straight and flush tables.
+ */
+uint32_t eval_five(Card hand) {
+        uint64_t c = ((hand & CLUB_BITMASK) >> CLUB_OFFSET);
+        uint64_t h = ((hand & HEART_BITMASK) >> HEART_OFFSET);
+        uint64_t d = ((hand & DIAMOND_BITMASK) >> DIAMOND_OFFSET);
+        uint64_t s = ((hand & SPADE_BITMASK) >> SPADE_OFFSET);
+        uint64_t ranks = c | h | d | s;
+
+        // A pair leaves only four ranks, too few for a straight or a flush
+        if (count_bits(ranks) < 5) {
+                return eval_ranks(c, h, d, s);
+        }
+
+        bool flush = ranks == c || ranks == h || ranks == d || ranks == s;
+        return eval_unpaired(ranks, flush ? ranks : 0);
+}
+
+/**
+ * Scores exactly six cards, with the same result as eval_hand. With six cards, the number of
+ * distinct ranks alone says which categories are possible, so most hands go straight to the
+ * evaluator of the one or two categories they can be.
+ */
+uint32_t eval_six(Card hand) {
+        uint64_t c = ((hand & CLUB_BITMASK) >> CLUB_OFFSET);
+        uint64_t h = ((hand & HEART_BITMASK) >> HEART_OFFSET);
+        uint64_t d = ((hand & DIAMOND_BITMASK) >> DIAMOND_OFFSET);
+        uint64_t s = ((hand & SPADE_BITMASK) >> SPADE_OFFSET);
+        uint64_t ranks = c | h | d | s;
+        // Ranks held once or three times
+        uint64_t odd = c ^ h ^ d ^ s;
+
+        switch (count_bits(ranks)) {
+        case 6:
+        case 5: {
+                // Five cards of one suit leave a single other card, too few for quads or a full
+                // house, so a flush is the best the ranks can do unless it is a straight flush
+                uint64_t flush = get_flushed_cards(hand);
+                if (flush || !(ranks & ~odd)) {
+                        return eval_unpaired(ranks, flush);
+                }
+
+                // Otherwise five ranks are one pair, unless they are a straight
+                uint32_t straight = straight_rank(ranks);
+                if (straight) {
+                        STATS_ADD(eval_categories[STATS_STRAIGHT], 1);
+                        return STRAIGHT_INDEX + 14 - straight;
+                }
+                STATS_ADD(eval_categories[STATS_PAIR], 1);
+                return eval_pair(ranks & ~odd, ranks);
+        }
+        case 4:
+                // Trips and three singles have every rank odd, and two pairs and two singles don't
+                if (odd == ranks) {
+                        STATS_ADD(eval_categories[STATS_TRIPS], 1);
+                        return eval_trips((c & h & (d | s)) | (d & s & (c | h)), ranks);
+                }
+                STATS_ADD(eval_categories[STATS_TWO_PAIR], 1);
+                return eval_two_pair(ranks & ~odd, ranks);
+        default:
+                return eval_ranks(c, h, d, s);
+        }
+}
+
+/**
+ * Scores five to seven cards with the evaluator for exactly that many
+ */
+uint32_t eval_cards(Card hand) {
+        switch (__builtin_popcountll(hand)) {
+        case 5:
+                return eval_five(hand);
+        case 6:
+                return eval_six(hand);
+        default:
+                return eval_hand(hand);
+        }
+}
+
+/**
+ * Scores cards written like "Ah". Empty strings add no card, so five or six cards can be scored
+ * too, each with the evaluator for that count.
+ */
 uint32_t eval_hand_strings(const char *c1, const char *c2, const char *c3, const char *c4,
                            const char *c5, const char *c6, const char *c7) {
         uint64_t hand = create_card(c1) | create_card(c2) | create_card(c3) | create_card(c4) |
                         create_card(c5) | create_card(c6) | create_card(c7);
 
-        return eval_hand(hand);
+        return eval_cards(hand);
 }
 
-void init_high_cards() {
+/**
+ * Returns the position of a 5-bit, non-straight rank mask in `unique_fives`, or UINT32_MAX if it
+ * isn't there
+ */
+uint32_t unique_five_index(const uint64_t *unique_fives, uint64_t mask) {
+        uint32_t l = 0;
+        uint32_t r = NUM_HIGH_CARD_HANDS;
+        while (l < r) {
+                uint32_t mid = (l + r) / 2;
+                if (unique_fives[mid] > mask) {
+                        r = mid;
+                } else if (unique_fives[mid] < mask) {
+                        l = mid + 1;
+                } else {
+                        return mid;
+                }
+        }
+
+        return UINT32_MAX;
+}
+
+/**
+ * Builds the tables in tables.h the slow way, by scanning rank masks
+ */
+void compute_rank_tables(struct RankTables *t) {
         uint64_t index = 0;
-        for (int i = 0; i < 1277; i += 1) {
-                while (count_bits(index) != 5 || straight_rank(index)) {
+        for (int i = 0; i < NUM_HIGH_CARD_HANDS; i += 1) {
+                while (count_bits(index) != 5 || compute_straight_rank(index)) {
                         index += 1;
                 }
 
-                unique_five_lookup_table[i] = index;
+                t->unique_fives[i] = index;
                 index += 1;
         }
+
+        for (uint64_t mask = 0; mask < NUM_RANK_MASKS; mask += 1) {
+                uint64_t top_five = mask;
+                for (uint32_t i = count_bits(top_five); i > 5; i -= 1) {
+                        // Flip the least significant 1-bit to 0
+                        top_five = top_five ^ (top_five & -top_five);
+                }
+
+                t->top_fives[mask] = top_five;
+                t->straight_ranks[mask] = compute_straight_rank(mask);
+                t->flush_ranks[mask] = UINT16_MAX;
+                t->high_card_ranks[mask] = UINT16_MAX;
+
+                if (count_bits(top_five) == 5) {
+                        uint32_t index = unique_five_index(t->unique_fives, top_five);
+                        if (index != UINT32_MAX) {
+                                t->flush_ranks[mask] = FLUSH_INDEX + NUM_FLUSHES - index - 1;
+                                t->high_card_ranks[mask] =
+                                    HIGH_CARD_INDEX + NUM_HIGH_CARD_HANDS - index - 1;
+                        }
+                }
+        }
 }
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "solver.c"
+
+#include <stdlib.h>
+
+// The flop decisions of every solved starting hand, in one file an advisory tool can map and
+// query without solving anything.
+//
+// Each starting hand keeps one margin per flop: the EV per unit ante of betting 2x minus that of
+// checking, so its sign is the decision and its size how close the decision is. Every flop of the
+// hand's deck has its own entry, copied from the canonical flop it was solved through, so a lookup
+// is one suit relabelling and one colex rank instead of a canonicalization.
+
+// Bump whenever the table layout or the margins it holds change
+const uint32_t FLOP_TABLE_VERSION = 1;
+
+#define FLOP_TABLE_KIND "flop-decisions"
+#define NUM_STARTING_HANDS 169
+
+struct FlopDecisionTable {
+        uint32_t version;
+        uint32_t hands_solved;
+        // Whether each starting hand has been added, padded to keep the margins aligned
+        uint8_t solved[176];
+        // Indexed by starting_hand_index, then by the colex rank of the flop among the cards left
+        // after the hand's normalized hole cards
+        float margins[NUM_STARTING_HANDS][NUM_FLOPS];
+};
+
+/**
+ * Returns the row of a starting hand in a 13 by 13 grid of ranks: pairs on the diagonal, suited
+ * hands on one side of it and offsuit hands on the other. `hole` must be normalized like
+ * normalize_suits leaves it.
+ */
+uint32_t starting_hand_index(Card hole) {
+        uint32_t low = __builtin_ctzll(hole);
+        uint32_t high = 63 - __builtin_clzll(hole);
+        uint32_t low_rank = low % 16;
+        uint32_t high_rank = high % 16;
+        if (low_rank > high_rank) {
+                uint32_t swap = low_rank;
+                low_rank = high_rank;
+                high_rank = swap;
+        }
+
+        bool suited = low / 16 == high / 16;
+        return suited ? high_rank * 13 + low_rank : low_rank * 13 + high_rank;
+}
+
+/**
+ * Returns an empty table, or the one saved at `path` so more hands can be added to it. Returns
+ * NULL if it can't be allocated.
+ */
+struct FlopDecisionTable *load_flop_table(const char *path) {
+        struct FlopDecisionTable *table = calloc(1, sizeof(struct FlopDecisionTable));
+        if (!table) {
+                fprintf(stderr, "Could not allocate flop decision table\n");
+                return NULL;
+        }
+        table->version = FLOP_TABLE_VERSION;
+
+        uint64_t size;
+        const struct FlopDecisionTable *saved =
+            path ? map_table_file(path, FLOP_TABLE_KIND, EVAL_VERSION, &size) : NULL;
+        if (saved) {
+                if (size == sizeof(struct FlopDecisionTable) &&
+                    saved->version == FLOP_TABLE_VERSION) {
+                        memcpy(table, saved, size);
+                }
+                unmap_table_file(saved, size);
+        }
+
+        return table;
+}
+
+/**
+ * Saves `table` to `path`, atomically. Returns false on any I/O error.
+ */
+bool save_flop_table(const struct FlopDecisionTable *table, const char *path) {
+        return write_table_file(path, FLOP_TABLE_KIND, EVAL_VERSION, table,
+                                sizeof(struct FlopDecisionTable));
+}
+
+/**
+ * Maps the table saved at `path` read-only, or returns NULL if there is no usable one. Release it
+ * with unmap_flop_table.
+ */
+const struct FlopDecisionTable *map_flop_table(const char *path) {
+        uint64_t size;
+        const struct FlopDecisionTable *table =
+            map_table_file(path, FLOP_TABLE_KIND, EVAL_VERSION, &size);
+        if (table && (size != sizeof(struct FlopDecisionTable) ||
+                      table->version != FLOP_TABLE_VERSION)) {
+                unmap_table_file(table, size);
+                return NULL;
+        }
+        return table;
+}
+
+void unmap_flop_table(const struct FlopDecisionTable *table) {
+        unmap_table_file(table, sizeof(struct FlopDecisionTable));
+}
+
+/**
+ * Copies the flop decisions of a solved hand into its row of `table`
+ */
+void add_flop_decisions(struct FlopDecisionTable *table, const struct Solution *solution) {
+        uint32_t hand = starting_hand_index(solution->hand);
+        float *margins = table->margins[hand];
+
+        struct CombinationIterator flops;
+        combinations_start(&flops, 3, solution->deck, 0);
+        for (uint32_t i = 0; i < NUM_FLOPS; i += 1, combinations_next(&flops)) {
+                const struct FlopNode *node = find_flop_node(solution, flops.cards);
+                // The difference is exact, so the sign always matches the solved action
+                margins[i] = flop_node_ev(node->bet_total - node->check_total);
+        }
+
+        if (!table->solved[hand]) {
+                table->solved[hand] = 1;
+                table->hands_solved += 1;
+        }
+}
+
+/**
+ * Looks up the flop decision after a preflop check for any hole cards and flop, storing the EV
+ * per unit ante betting 2x gains over checking in `margin`. Returns false if the hand isn't in
+ * `table`.
+ */
+bool lookup_flop_decision(const struct FlopDecisionTable *table, Card hole, Card flop,
+                          enum Action *action, double *margin) {
+        hole = normalize_suits(hole, &flop);
+        uint32_t hand = starting_hand_index(hole);
+        if (!table->solved[hand]) {
+                return false;
+        }
+
+        *margin = table->margins[hand][kernels->combination_index(flop, FULL_DECK ^ hole)];
+        *action = *margin >= 0 ? ACTION_BET_2X : ACTION_CHECK;
+        return true;
+}
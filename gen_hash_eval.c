@@ -0,0 +1,43 @@
+#include "hash_eval.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Builds the hash evaluator table into its shared location, see hash_eval_table_path, unless an
+// intact, up to date one is already there. The Makefile runs it alongside every binary that
+// evaluates with the hash engine, so none of them has to build it on its first run.
+
+int main(int argc, char **argv) {
+        char path[4096];
+        if (!hash_eval_table_path(path, sizeof(path))) {
+                fprintf(stderr, "No usable location for the hash evaluator table\n");
+                return 1;
+        }
+
+        verify_table_checksums = true;
+        uint64_t size;
+        const void *mapped = map_table_file(path, HASH_EVAL_TABLE_KIND, EVAL_VERSION, &size);
+        if (mapped) {
+                bool ok = size == sizeof(struct HashEvalTable);
+                unmap_table_file(mapped, size);
+                if (ok) {
+                        return 0;
+                }
+        }
+
+        struct HashEvalTable *generated = generate_hash_eval_table();
+        if (!generated) {
+                fprintf(stderr, "Could not allocate the hash evaluator table\n");
+                return 1;
+        }
+        bool ok = write_table_file(path, HASH_EVAL_TABLE_KIND, EVAL_VERSION, generated,
+                                   sizeof(struct HashEvalTable));
+        free(generated);
+        if (!ok) {
+                fprintf(stderr, "Could not write %s\n", path);
+                return 1;
+        }
+
+        printf("Wrote %s\n", path);
+        return 0;
+}
@@ -0,0 +1,74 @@
+#define GENERATING_TABLES
+#include "eval.c"
+#include "combination.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Writes tables.h, the lookup tables eval.c and combination.c compile in, to stdout. They are
+// built with the same functions that used to fill them at startup, and `make tables` rebuilds
+// the header whenever those change. The tests check the header against those functions too.
+
+#define LINE_WIDTH 100
+
+/**
+ * Prints a const table of `count` integers of `size` bytes, named `name` and of type `type`,
+ * wrapping the values at LINE_WIDTH columns
+ */
+void print_table(const char *type, const char *name, const void *table, uint32_t size,
+                 uint32_t count) {
+        printf("\nconst %s %s[%u] = {\n", type, name, count);
+
+        char line[LINE_WIDTH + 1] = "   ";
+        uint32_t length = 3;
+        for (uint32_t i = 0; i < count; i += 1) {
+                uint64_t value = size == 1   ? ((const uint8_t *)table)[i]
+                                 : size == 2 ? ((const uint16_t *)table)[i]
+                                             : ((const uint64_t *)table)[i];
+                char piece[24];
+                uint32_t piece_length = snprintf(piece, sizeof(piece), " %lu,", value);
+                if (length + piece_length > LINE_WIDTH) {
+                        printf("%s\n", line);
+                        length = 3;
+                }
+                memcpy(line + length, piece, piece_length + 1);
+                length += piece_length;
+        }
+
+        printf("%s\n};\n", line);
+}
+
+int main(int argc, char **argv) {
+        struct RankTables *t = malloc(sizeof(struct RankTables));
+        if (!t) {
+                fprintf(stderr, "Could not allocate tables\n");
+                return 1;
+        }
+        uint64_t binomials[MAX_COMBINATION_BITS + 1][MAX_COMBINATION_SIZE + 1];
+        compute_rank_tables(t);
+        compute_binomials(binomials);
+
+        printf("// Generated by gen_tables.c with `make tables`. Do not edit.\n\n"
+               "#pragma once\n\n"
+               "#include <stdint.h>\n");
+        print_table("uint64_t", "unique_five_lookup_table", t->unique_fives, 8,
+                    NUM_HIGH_CARD_HANDS);
+        print_table("uint16_t", "top_five_table", t->top_fives, 2, NUM_RANK_MASKS);
+        print_table("uint16_t", "flush_rank_table", t->flush_ranks, 2, NUM_RANK_MASKS);
+        print_table("uint16_t", "high_card_rank_table", t->high_card_ranks, 2, NUM_RANK_MASKS);
+        print_table("uint8_t", "straight_rank_table", t->straight_ranks, 1, NUM_RANK_MASKS);
+
+        printf("\nconst uint64_t binomial_table[%d][%d] = {\n", MAX_COMBINATION_BITS + 1,
+               MAX_COMBINATION_SIZE + 1);
+        for (uint32_t n = 0; n <= MAX_COMBINATION_BITS; n += 1) {
+                printf("    {");
+                for (uint32_t k = 0; k <= MAX_COMBINATION_SIZE; k += 1) {
+                        printf(k ? ", %lu" : "%lu", binomials[n][k]);
+                }
+                printf("},\n");
+        }
+        printf("};\n");
+
+        free(t);
+        return 0;
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "eval.c"
+#include "table_file.c"
+
+#include <stdlib.h>
+#include <sys/stat.h>
+
+// Perfect-hash evaluator. Each rank gets a key such that every multiset of 5 to 7 ranks (at most
+// four of each) has a distinct key sum, so a non-flush hand is scored by summing the keys of its
+// four suit masks and loading rank_scores[sum]. Flushes are scored from the flushed suit mask
+// alone, since with 7 cards a flush rules out quads and full houses.
+const uint32_t HASH_RANK_KEYS[13] = {
+    1, 5, 24, 112, 521, 2247, 9244, 30823, 103066, 250154, 667453, 1526359, 3453520,
+};
+
+// Largest key sum is four aces and three kings
+#define HASH_TABLE_SIZE (4 * 3453520 + 3 * 1526359 + 1)
+#define HASH_EVAL_TABLE_KIND "hash-eval"
+
+
+struct HashEvalTable {
+        // Sum of HASH_RANK_KEYS over the set bits of a suit mask
+        uint32_t rank_keys[NUM_RANK_MASKS];
+        // Score of a suit mask holding 5+ cards (straight flush or flush), UINT16_MAX otherwise
+        uint16_t flush_scores[NUM_RANK_MASKS];
+        // Score of a rank multiset, indexed by its key sum. One spare entry at the end keeps 32-bit
+        // vector gathers of the last score inside the table.
+        uint16_t rank_scores[HASH_TABLE_SIZE + 1];
+};
+
+const struct HashEvalTable *hash_eval_table = NULL;
+
+uint32_t eval_hand_hash(Card hand) {
+        const struct HashEvalTable *t = hash_eval_table;
+        uint64_t s = (hand & SPADE_BITMASK) >> SPADE_OFFSET;
+        uint64_t h = (hand & HEART_BITMASK) >> HEART_OFFSET;
+        uint64_t d = (hand & DIAMOND_BITMASK) >> DIAMOND_OFFSET;
+        uint64_t c = (hand & CLUB_BITMASK) >> CLUB_OFFSET;
+
+        uint32_t key = t->rank_keys[s] + t->rank_keys[h] + t->rank_keys[d] + t->rank_keys[c];
+        uint32_t score = t->rank_scores[key];
+
+        // A flushed suit always beats the rank multiset, so min() picks it without a branch
+        uint32_t flush1 = t->flush_scores[s] < t->flush_scores[h] ? t->flush_scores[s]
+                                                                   : t->flush_scores[h];
+        uint32_t flush2 = t->flush_scores[d] < t->flush_scores[c] ? t->flush_scores[d]
+                                                                   : t->flush_scores[c];
+        uint32_t flush = flush1 < flush2 ? flush1 : flush2;
+
+        STATS_ADD(hash_evals, 1);
+        return flush < score ? flush : score;
+}
+
+/**
+ * Fills rank_scores for every multiset of `remaining` more cards over ranks [rank, 13), scoring
+ * each with eval_hand. Copies of a rank are dealt to consecutive suits in round-robin order, so no
+ * suit ever gets more than two cards and the representative hand never flushes.
+ */
+void fill_rank_scores(struct HashEvalTable *t, uint32_t rank, uint32_t dealt, uint32_t remaining,
+                      uint32_t key, Card hand) {
+        if (remaining == 0) {
+                t->rank_scores[key] = eval_hand(hand);
+                return;
+        }
+        if (rank == 13) {
+                return;
+        }
+
+        for (uint32_t count = 0; count <= 4 && count <= remaining; count += 1) {
+                Card cards = 0;
+                for (uint32_t i = 0; i < count; i += 1) {
+                        uint64_t suit = SPADE_BITMASK << (16 * ((dealt + i) % 4));
+                        cards |= (DEUCE_BITMASK << rank) & suit;
+                }
+
+                fill_rank_scores(t, rank + 1, dealt + count, remaining - count,
+                                 key + count * HASH_RANK_KEYS[rank], hand | cards);
+        }
+}
+
+/**
+ * Builds the hash evaluator table from eval_hand
+ */
+struct HashEvalTable *generate_hash_eval_table() {
+        struct HashEvalTable *t = malloc(sizeof(struct HashEvalTable));
+        if (!t) {
+                return NULL;
+        }
+
+        for (uint64_t mask = 0; mask < NUM_RANK_MASKS; mask += 1) {
+                t->rank_keys[mask] = 0;
+                for (uint32_t rank = 0; rank < 13; rank += 1) {
+                        if (mask & (1ull << rank)) {
+                                t->rank_keys[mask] += HASH_RANK_KEYS[rank];
+                        }
+                }
+
+                // Spades sit at offset 0, so a bare rank mask is already a one-suit hand
+                t->flush_scores[mask] = count_bits(mask) >= 5 ? eval_hand(mask) : UINT16_MAX;
+        }
+
+        for (uint32_t i = 0; i < HASH_TABLE_SIZE + 1; i += 1) {
+                t->rank_scores[i] = UINT16_MAX;
+        }
+        for (uint32_t cards = 5; cards <= 7; cards += 1) {
+                fill_rank_scores(t, 0, 0, cards, 0, NULL_CARD);
+        }
+
+        return t;
+}
+
+/**
+ * Writes where the hash evaluator table is kept to `path`, so every working directory shares one
+ * file: $UTX_HASH_TABLE if set, otherwise utx/hash_eval.tbl under $XDG_CACHE_HOME or ~/.cache,
+ * creating those directories as needed. Without either, it is kept in the working directory.
+ * Returns false if the path doesn't fit.
+ */
+bool hash_eval_table_path(char *path, size_t size) {
+        const char *override = getenv("UTX_HASH_TABLE");
+        if (override && *override) {
+                return snprintf(path, size, "%s", override) < (int)size;
+        }
+
+        const char *cache = getenv("XDG_CACHE_HOME");
+        const char *home = getenv("HOME");
+        int length;
+        if (cache && *cache) {
+                length = snprintf(path, size, "%s", cache);
+        } else if (home && *home) {
+                length = snprintf(path, size, "%s/.cache", home);
+        } else {
+                return snprintf(path, size, "hash_eval.tbl") < (int)size;
+        }
+        if (length >= (int)size) {
+                return false;
+        }
+        // If a directory can't be made, writing the table fails and init_hash_eval keeps it in
+        // memory instead
+        mkdir(path, 0777);
+        length += snprintf(path + length, size - length, "/utx");
+        if (length >= (int)size) {
+                return false;
+        }
+        mkdir(path, 0777);
+        return snprintf(path + length, size - length, "/hash_eval.tbl") < (int)(size - length);
+}
+
+/**
+ * Maps the hash evaluator table from `path`, generating and writing it first if the file is
+ * missing or stale. Falls back to an in-memory table if the file can't be written. Returns false
+ * only if no table could be built.
+ */
+bool init_hash_eval(const char *path) {
+        if (hash_eval_table) {
+                return true;
+        }
+
+        uint64_t size;
+        const void *mapped = map_table_file(path, HASH_EVAL_TABLE_KIND, EVAL_VERSION, &size);
+        if (mapped && size == sizeof(struct HashEvalTable)) {
+                hash_eval_table = mapped;
+                return true;
+        } else if (mapped) {
+                unmap_table_file(mapped, size);
+        }
+
+        struct HashEvalTable *generated = generate_hash_eval_table();
+        if (!generated) {
+                return false;
+        }
+
+        if (write_table_file(path, HASH_EVAL_TABLE_KIND, EVAL_VERSION, generated,
+                             sizeof(struct HashEvalTable))) {
+                mapped = map_table_file(path, HASH_EVAL_TABLE_KIND, EVAL_VERSION, &size);
+                if (mapped) {
+                        free(generated);
+                        hash_eval_table = mapped;
+                        return true;
+                }
+        }
+
+        fprintf(stderr, "Could not write %s, using an in-memory hash table\n", path);
+        hash_eval_table = generated;
+        return true;
+}
+
+/**
+ * Maps the hash evaluator table from its shared location, see hash_eval_table_path
+ */
+bool init_default_hash_eval() {
+        if (hash_eval_table) {
+                return true;
+        }
+
+        char path[4096];
+        if (!hash_eval_table_path(path, sizeof(path))) {
+                fprintf(stderr, "No usable location for the hash evaluator table\n");
+                return false;
+        }
+        return init_hash_eval(path);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Instruction set levels the hot kernels are built for, following the x86-64 microarchitecture
+// levels: v2 adds hardware popcount, v3 BMI2 (pdep/pext), LZCNT and AVX2, and v4 AVX-512. The
+// baseline level is whatever the binary itself is built with. dispatch.c compiles every kernel
+// once per level, and init_isa picks the best level the CPU supports at startup. Setting UTX_ISA
+// to a level's name picks that one instead, e.g. to benchmark the levels against each other.
+enum Isa { ISA_X86_64, ISA_X86_64_V2, ISA_X86_64_V3, ISA_X86_64_V4, NUM_ISAS };
+
+const char *ISA_NAMES[NUM_ISAS] = {"x86-64", "x86-64-v2", "x86-64-v3", "x86-64-v4"};
+
+// The selected level; set by init_isa
+enum Isa selected_isa = ISA_X86_64;
+bool isa_initialized = false;
+
+/**
+ * Returns the level with the given name, or NUM_ISAS if there is none
+ */
+enum Isa parse_isa(const char *name) {
+        for (int i = 0; i < NUM_ISAS; i += 1) {
+                if (strcmp(name, ISA_NAMES[i]) == 0) {
+                        return i;
+                }
+        }
+
+        return NUM_ISAS;
+}
+
+bool isa_supported(enum Isa isa) {
+        __builtin_cpu_init();
+        switch (isa) {
+        case ISA_X86_64_V2:
+                return __builtin_cpu_supports("x86-64-v2");
+        case ISA_X86_64_V3:
+                return __builtin_cpu_supports("x86-64-v3");
+        case ISA_X86_64_V4:
+                return __builtin_cpu_supports("x86-64-v4");
+        default:
+                return isa == ISA_X86_64;
+        }
+}
+
+/**
+ * Selects the best level the CPU supports, or the one UTX_ISA names if the CPU supports it, and
+ * returns it. Only the first call looks.
+ */
+enum Isa init_isa() {
+        if (isa_initialized) {
+                return selected_isa;
+        }
+        isa_initialized = true;
+
+        selected_isa = ISA_X86_64;
+        for (int isa = NUM_ISAS - 1; isa > ISA_X86_64; isa -= 1) {
+                if (isa_supported(isa)) {
+                        selected_isa = isa;
+                        break;
+                }
+        }
+
+        const char *name = getenv("UTX_ISA");
+        if (name && *name) {
+                enum Isa forced = parse_isa(name);
+                if (forced == NUM_ISAS) {
+                        fprintf(stderr, "Unknown UTX_ISA '%s', using %s\n", name,
+                                ISA_NAMES[selected_isa]);
+                } else if (!isa_supported(forced)) {
+                        fprintf(stderr, "This CPU can't run UTX_ISA %s, using %s\n", name,
+                                ISA_NAMES[selected_isa]);
+                } else {
+                        selected_isa = forced;
+                }
+        }
+
+        return selected_isa;
+}
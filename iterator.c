@@ -0,0 +1,112 @@
+// The combination iterator and colex ranking, built once per instruction set level with
+// KERNEL(name) naming each copy: combination.c builds the default one, and dispatch.c one per
+// level for its kernels, so the BMI2 copies step and rank with pdep and pext. A
+// CombinationIterator must only be used with the copy that started it.
+
+/**
+ * Packs the bits of `cards` that are in `live` into the low bits, in order
+ */
+uint64_t KERNEL(card_pext)(uint64_t cards, uint64_t live) {
+#ifdef __BMI2__
+        return _pext_u64(cards, live);
+#else
+        uint64_t dense = 0;
+        for (cards &= live; cards; cards &= cards - 1) {
+                dense |= 1ull << __builtin_popcountll(live & ((cards & -cards) - 1));
+        }
+        return dense;
+#endif
+}
+
+/**
+ * Spreads the low bits of `dense` over the set bits of `live`, in order. The inverse of
+ * card_pext.
+ */
+uint64_t KERNEL(card_pdep)(uint64_t dense, uint64_t live) {
+#ifdef __BMI2__
+        return _pdep_u64(dense, live);
+#else
+        uint64_t cards = 0;
+        for (uint64_t bit = 1; live && dense >= bit; live &= live - 1, bit <<= 1) {
+                cards |= dense & bit ? live & -live : 0;
+        }
+        return cards;
+#endif
+}
+
+/**
+ * Returns the index-th k-subset of the bits in live, in the order next_combination visits them.
+ */
+uint64_t KERNEL(nth_combination)(uint64_t index, uint32_t k, uint64_t live) {
+        return KERNEL(card_pdep)(nth_dense_combination(index, k, __builtin_popcountll(live)), live);
+}
+
+/**
+ * Returns the position of `combination` among the subsets of live of its size, in the order
+ * next_combination visits them. The inverse of nth_combination.
+ */
+uint64_t KERNEL(combination_index)(uint64_t combination, uint64_t live) {
+        uint64_t dense = KERNEL(card_pext)(combination, live);
+        uint64_t index = 0;
+
+        for (uint32_t j = 1; dense; j += 1, dense &= dense - 1) {
+                index += binomial_table[__builtin_ctzll(dense)][j];
+        }
+
+        return index;
+}
+
+/**
+ * Spreads a dense subset into cards
+ */
+Card KERNEL(iterator_cards)(const struct CombinationIterator *it, uint64_t dense) {
+#ifdef __BMI2__
+        return _pdep_u64(dense, it->live);
+#else
+        Card cards = 0;
+        for (; dense; dense &= dense - 1) {
+                cards |= it->live_cards[__builtin_ctzll(dense)];
+        }
+        return cards;
+#endif
+}
+
+/**
+ * Starts walking the k-subsets of the cards in `live` at the index-th one, in the order
+ * next_combination visits them. Seeking straight to an index lets threads each take a chunk.
+ */
+void KERNEL(combinations_start)(struct CombinationIterator *it, uint32_t k, Card live,
+                                uint64_t index) {
+        uint32_t n = __builtin_popcountll(live);
+        it->live = live;
+        it->end = 1ull << n;
+#ifndef __BMI2__
+        for (uint32_t i = 0; live; i += 1, live &= live - 1) {
+                it->live_cards[i] = live & -live;
+        }
+#endif
+        it->dense = nth_dense_combination(index, k, n);
+        it->cards = KERNEL(iterator_cards)(it, it->dense);
+}
+
+/**
+ * Steps to the next subset. Returns false, leaving the last one in place, once there are no more.
+ */
+bool KERNEL(combinations_next)(struct CombinationIterator *it) {
+        STATS_ADD(combinations, 1);
+        uint64_t x = it->dense;
+        if (!x) {
+                return false;
+        }
+
+        uint64_t smallest = x & -x;
+        uint64_t ripple = x + smallest;
+        uint64_t next = ripple | ((((ripple & -ripple) / smallest) >> 1) - 1);
+        if (next >= it->end) {
+                return false;
+        }
+
+        it->dense = next;
+        it->cards = KERNEL(iterator_cards)(it, next);
+        return true;
+}
@@ -0,0 +1,45 @@
+// The hot kernels, built once per instruction set level by dispatch.c with KERNEL(name) naming
+// each copy. Everything a kernel inlines is compiled for its level too, so the same source gets
+// hardware popcount, tzcnt/lzcnt and pdep wherever the level has them.
+
+/**
+ * Counts how a player with `player_score` on the board in `state` fares against every dealer
+ * hole from the cards in `live`. Requires init_hash_eval.
+ */
+struct DealerCounts KERNEL(score_dealers)(const struct BoardState *state, Card live,
+                                          uint32_t player_score) {
+        struct DealerCounts counts = {0, 0, 0};
+        struct CombinationIterator dealers;
+        KERNEL(combinations_start)(&dealers, 2, live, 0);
+
+        do {
+                uint32_t dealer_score = board_eval_finish(state, dealers.cards);
+                bool win = player_score < dealer_score;
+                bool qualified = dealer_score < HIGH_CARD_INDEX;
+
+                counts.wins_qualified += win & qualified;
+                counts.wins_unqualified += win & !qualified;
+                counts.losses += player_score > dealer_score;
+        } while (KERNEL(combinations_next)(&dealers));
+
+        return counts;
+}
+
+/**
+ * Writes `count` k-subsets of the cards in `live` to `cards`, starting at the index-th, in the
+ * order next_combination visits them.
+ */
+void KERNEL(enumerate_combinations)(uint32_t k, Card live, uint64_t index, Card *cards,
+                                    uint64_t count) {
+        struct CombinationIterator it;
+        KERNEL(combinations_start)(&it, k, live, index);
+        for (uint64_t i = 0; i < count; i += 1, KERNEL(combinations_next)(&it)) {
+                cards[i] = it.cards;
+        }
+}
+
+__attribute__((flatten)) uint32_t KERNEL(eval_hand)(Card hand) { return eval_hand(hand); }
+
+__attribute__((flatten)) uint32_t KERNEL(eval_hand_hash)(Card hand) {
+        return eval_hand_hash(hand);
+}
@@ -1,3 +1,3 @@
 #include "eval.c"
 
-int main(int argc, char **argv) { init_high_cards(); }
+int main(int argc, char **argv) {}
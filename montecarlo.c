@@ -0,0 +1,270 @@
+#pragma once
+
+#include "solver.c"
+
+#include <math.h>
+
+// Monte Carlo estimate of the preflop EVs, for quick answers where the exact solve is too slow.
+//
+// One sample is one random flop and `boards_per_flop` random turn/river cards under it. Each
+// board is scored exactly against all 990 dealer holes with evaluate(), and packed into a
+// BoardOutcome so every bet size and the river fold use the solver's payouts. A sample's raise EVs
+// are the mean of its boards, and its check EV is the better flop action over the same boards.
+// That max() over a finite number of boards biases the check EV slightly upwards, less so with
+// more boards per flop.
+//
+// Samples are drawn in fixed-size batches, each with its own xoshiro256** stream, and batch
+// totals are folded in batch order, so an estimate only depends on the seed and not on how many
+// threads drew it.
+
+#define MONTE_CARLO_BATCH_SIZE 16
+#define MONTE_CARLO_ROUND_BATCHES 16
+#define MONTE_CARLO_SAMPLES_PER_ROUND (MONTE_CARLO_BATCH_SIZE * MONTE_CARLO_ROUND_BATCHES)
+
+// Per-sample quantities tracked by the estimate; the last is raise 4x minus check, whose
+// variance decides whether the preflop decision is settled
+enum MonteCarloValue { MC_RAISE4, MC_RAISE3, MC_CHECK, MC_DIFFERENCE, NUM_MC_VALUES };
+
+struct MonteCarloOptions {
+        uint64_t max_samples;
+        // Stop once every EV's 95% confidence half-width is below this
+        double target_ci;
+        // Stop once raise and check are this many standard errors apart
+        double separation;
+        uint64_t seed;
+        uint32_t boards_per_flop;
+};
+
+const struct MonteCarloOptions DEFAULT_MONTE_CARLO_OPTIONS = {
+    .max_samples = 1 << 16,
+    .target_ci = 0.005,
+    .separation = 4.0,
+    .seed = 1,
+    .boards_per_flop = 32,
+};
+
+struct MonteCarloEstimate {
+        double evs[NUM_MC_VALUES];
+        // 95% confidence half-widths
+        double cis[NUM_MC_VALUES];
+        uint64_t samples;
+        bool separated;
+};
+
+struct Xoshiro256 {
+        uint64_t s[4];
+};
+
+uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+uint64_t xoshiro_next(struct Xoshiro256 *rng) {
+        uint64_t *s = rng->s;
+        uint64_t result = rotl(s[1] * 5, 7) * 9;
+        uint64_t t = s[1] << 17;
+
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+
+        return result;
+}
+
+/**
+ * Seeds the stream of one batch through splitmix64, as the xoshiro authors recommend
+ */
+void xoshiro_seed(struct Xoshiro256 *rng, uint64_t seed, uint64_t stream) {
+        uint64_t z = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+        for (int i = 0; i < 4; i += 1) {
+                z += 0x9E3779B97F4A7C15ULL;
+                uint64_t x = z;
+                x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+                rng->s[i] = x ^ (x >> 31);
+        }
+}
+
+/**
+ * Returns `count` random cards that aren't in `dead`
+ */
+Card draw_cards(struct Xoshiro256 *rng, Card dead, uint32_t count) {
+        Card cards = 0;
+        while (count > 0) {
+                uint64_t index = ((xoshiro_next(rng) >> 32) * 52) >> 32;
+                Card card = 1ull << (16 * (index / 13) + index % 13);
+                if (!((dead | cards) & card)) {
+                        cards |= card;
+                        count -= 1;
+                }
+        }
+        return cards;
+}
+
+/**
+ * Scores a five-card board against every dealer hole
+ */
+struct BoardOutcome sample_board_outcome(Card hand, Card board) {
+        uint32_t player_score = evaluate(hand | board);
+        uint32_t wins_qualified = 0;
+        uint32_t wins_unqualified = 0;
+        uint32_t losses = 0;
+
+        struct CombinationIterator dealers;
+        combinations_start(&dealers, 2, FULL_DECK ^ hand ^ board, 0);
+        for (int k = 0; k < NUM_DEALER_HOLES; k += 1, combinations_next(&dealers)) {
+                uint32_t dealer_score = evaluate(board | dealers.cards);
+                bool win = player_score < dealer_score;
+                bool qualified = dealer_score < HIGH_CARD_INDEX;
+
+                wins_qualified += win & qualified;
+                wins_unqualified += win & !qualified;
+                losses += player_score > dealer_score;
+        }
+
+        return board_outcome(wins_qualified, wins_unqualified, losses, player_score);
+}
+
+/**
+ * Draws one sample and stores its value of each MonteCarloValue, per unit ante
+ */
+void draw_sample(Card hand, uint32_t boards_per_flop, struct Xoshiro256 *rng,
+                 double values[NUM_MC_VALUES]) {
+        Card flop = draw_cards(rng, hand, 3);
+        int64_t raise4 = 0;
+        int64_t raise3 = 0;
+        int64_t bet = 0;
+        int64_t check = 0;
+
+        for (uint32_t i = 0; i < boards_per_flop; i += 1) {
+                Card board = flop | draw_cards(rng, hand | flop, 2);
+                struct BoardOutcome outcome = sample_board_outcome(hand, board);
+
+                int64_t river_value;
+                river_decision(outcome, &river_value);
+                raise4 += outcome_payout(outcome, 4);
+                raise3 += outcome_payout(outcome, 3);
+                bet += outcome_payout(outcome, 2);
+                check += river_value;
+        }
+
+        double scale = (double)HALF_UNITS * NUM_DEALER_HOLES * boards_per_flop;
+        values[MC_RAISE4] = raise4 / scale;
+        values[MC_RAISE3] = raise3 / scale;
+        values[MC_CHECK] = max_int64(bet, check) / scale;
+        values[MC_DIFFERENCE] = values[MC_RAISE4] - values[MC_CHECK];
+}
+
+struct MonteCarloJob {
+        Card hand;
+        const struct MonteCarloOptions *options;
+        uint64_t first_batch;
+        uint32_t next_batch;
+        double sums[MONTE_CARLO_ROUND_BATCHES][NUM_MC_VALUES];
+        double sum_squares[MONTE_CARLO_ROUND_BATCHES][NUM_MC_VALUES];
+};
+
+void *monte_carlo_worker(void *arg) {
+        struct MonteCarloJob *job = arg;
+
+        for (;;) {
+                uint32_t batch = __atomic_fetch_add(&job->next_batch, 1, __ATOMIC_RELAXED);
+                if (batch >= MONTE_CARLO_ROUND_BATCHES) {
+                        return NULL;
+                }
+
+                struct Xoshiro256 rng;
+                xoshiro_seed(&rng, job->options->seed, job->first_batch + batch);
+                for (int v = 0; v < NUM_MC_VALUES; v += 1) {
+                        job->sums[batch][v] = 0.0;
+                        job->sum_squares[batch][v] = 0.0;
+                }
+
+                for (int i = 0; i < MONTE_CARLO_BATCH_SIZE; i += 1) {
+                        double values[NUM_MC_VALUES];
+                        draw_sample(job->hand, job->options->boards_per_flop, &rng, values);
+                        for (int v = 0; v < NUM_MC_VALUES; v += 1) {
+                                job->sums[batch][v] += values[v];
+                                job->sum_squares[batch][v] += values[v] * values[v];
+                        }
+                }
+        }
+}
+
+/**
+ * Estimates the preflop EVs of `hand`, drawing rounds of samples until the raise/check decision
+ * is separated, every confidence interval is narrow enough, or max_samples is reached. Samples
+ * are drawn in whole rounds of MONTE_CARLO_SAMPLES_PER_ROUND, so max_samples is rounded up to one.
+ * Requires init_engine. Returns false if the job can't be allocated.
+ */
+bool estimate_hand(Card hand, const struct MonteCarloOptions *options,
+                   struct MonteCarloEstimate *estimate) {
+        double sums[NUM_MC_VALUES] = {0};
+        double sum_squares[NUM_MC_VALUES] = {0};
+        uint64_t samples = 0;
+
+        struct MonteCarloJob *job = malloc(sizeof(struct MonteCarloJob));
+        if (!job) {
+                fprintf(stderr, "Could not allocate Monte Carlo job\n");
+                return false;
+        }
+        job->hand = hand;
+        job->options = options;
+
+        memset(estimate, 0, sizeof(*estimate));
+        while (samples < options->max_samples) {
+                job->first_batch = samples / MONTE_CARLO_BATCH_SIZE;
+                job->next_batch = 0;
+
+                pthread_t threads[num_threads];
+                uint32_t spawned = 0;
+                while (spawned + 1 < num_threads &&
+                       pthread_create(&threads[spawned], NULL, monte_carlo_worker, job) == 0) {
+                        spawned += 1;
+                }
+                monte_carlo_worker(job);
+                for (uint32_t t = 0; t < spawned; t += 1) {
+                        pthread_join(threads[t], NULL);
+                }
+
+                for (int batch = 0; batch < MONTE_CARLO_ROUND_BATCHES; batch += 1) {
+                        for (int v = 0; v < NUM_MC_VALUES; v += 1) {
+                                sums[v] += job->sums[batch][v];
+                                sum_squares[v] += job->sum_squares[batch][v];
+                        }
+                }
+                samples += MONTE_CARLO_SAMPLES_PER_ROUND;
+
+                bool narrow = true;
+                for (int v = 0; v < NUM_MC_VALUES; v += 1) {
+                        double mean = sums[v] / samples;
+                        double variance = (sum_squares[v] - samples * mean * mean) / (samples - 1);
+                        estimate->evs[v] = mean;
+                        estimate->cis[v] = 1.96 * sqrt(variance > 0.0 ? variance / samples : 0.0);
+                        narrow &= v == MC_DIFFERENCE || estimate->cis[v] <= options->target_ci;
+                }
+                estimate->samples = samples;
+
+                double standard_error = estimate->cis[MC_DIFFERENCE] / 1.96;
+                estimate->separated =
+                    fabs(estimate->evs[MC_DIFFERENCE]) > options->separation * standard_error;
+                if (estimate->separated || narrow) {
+                        break;
+                }
+        }
+
+        free(job);
+        return true;
+}
+
+/**
+ * Returns the preflop action with the best estimated EV
+ */
+enum Action estimated_action(const struct MonteCarloEstimate *estimate) {
+        const double *evs = estimate->evs;
+        if (evs[MC_RAISE4] >= evs[MC_RAISE3] && evs[MC_RAISE4] >= evs[MC_CHECK]) {
+                return ACTION_RAISE_4X;
+        }
+        return evs[MC_RAISE3] > evs[MC_CHECK] ? ACTION_RAISE_3X : ACTION_CHECK;
+}
@@ -0,0 +1,118 @@
+#include "engine.c"
+#include "equity.c"
+
+#include <time.h>
+#include <unistd.h>
+
+// Exhaustive equity of one range against another, e.g.
+//
+//     ./odds --board Ah7d2c "AKs, TT+" "QQ, AhKh"
+
+enum OutputFormat { FORMAT_TEXT, FORMAT_JSON };
+
+void usage(const char *program) {
+        fprintf(stderr,
+                "usage: %s [-t threads] [--board cards] [--dead cards] [--format text|json]\n"
+                "          range range\n"
+                "  ranges are lists like \"AKs, TT+, A5s-A2s, KQ, AhKd:0.5\"; a :weight scales\n"
+                "  an item's combos\n"
+                "  --board holds 0 to 5 cards like Ah7d2c, and --dead cards no one can hold\n",
+                program);
+}
+
+/**
+ * Parses a string of cards like "Ah7d2c" into `cards`. Returns false unless they are all valid
+ * and distinct.
+ */
+bool parse_card_list(const char *text, Card *cards) {
+        size_t length = strlen(text);
+        return length % 2 == 0 && length <= 2 * 52 && parse_cards(text, length / 2, cards);
+}
+
+int main(int argc, char **argv) {
+        enum OutputFormat format = FORMAT_TEXT;
+        uint32_t threads = sysconf(_SC_NPROCESSORS_ONLN);
+        Card board = 0;
+        Card dead = 0;
+        const char *range_texts[2];
+        int num_ranges = 0;
+
+        for (int i = 1; i < argc; i += 1) {
+                if ((strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--threads") == 0) &&
+                    i + 1 < argc) {
+                        threads = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "--board") == 0 && i + 1 < argc) {
+                        if (!parse_card_list(argv[++i], &board)) {
+                                fprintf(stderr, "Invalid board '%s'\n", argv[i]);
+                                return 1;
+                        }
+                } else if (strcmp(argv[i], "--dead") == 0 && i + 1 < argc) {
+                        if (!parse_card_list(argv[++i], &dead)) {
+                                fprintf(stderr, "Invalid dead cards '%s'\n", argv[i]);
+                                return 1;
+                        }
+                } else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+                        i += 1;
+                        if (strcmp(argv[i], "json") == 0) {
+                                format = FORMAT_JSON;
+                        } else if (strcmp(argv[i], "text") == 0) {
+                                format = FORMAT_TEXT;
+                        } else {
+                                usage(argv[0]);
+                                return 1;
+                        }
+                } else if (argv[i][0] != '-' && num_ranges < 2) {
+                        range_texts[num_ranges++] = argv[i];
+                } else {
+                        usage(argv[0]);
+                        return 1;
+                }
+        }
+        if (num_ranges != 2) {
+                usage(argv[0]);
+                return 1;
+        }
+        if (threads < 1) {
+                threads = 1;
+        }
+
+        struct Range *ranges = malloc(2 * sizeof(struct Range));
+        if (!ranges) {
+                fprintf(stderr, "Could not allocate ranges\n");
+                return 1;
+        }
+        if (!parse_range(range_texts[0], &ranges[0]) || !parse_range(range_texts[1], &ranges[1])) {
+                return 1;
+        }
+
+        if (!init_engine(ENGINE_HASH)) {
+                return 1;
+        }
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        struct EquityResult result;
+        if (!compute_equity(&ranges[0], &ranges[1], board, dead, threads, &result)) {
+                return 1;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+        double share = equity_share(&result);
+        if (format == FORMAT_TEXT) {
+                printf("%s: %.4f%% (win %.15g, tie %.15g, loss %.15g)\n", range_texts[0],
+                       100 * share, result.wins, result.ties, result.losses);
+                printf("%s: %.4f%% (win %.15g, tie %.15g, loss %.15g)\n", range_texts[1],
+                       100 * (1 - share), result.losses, result.ties, result.wins);
+                printf("%lu runouts, %u + %u combos, %.3fs\n", result.runouts, ranges[0].size,
+                       ranges[1].size, seconds);
+        } else {
+                printf("{\"ranges\": [\"%s\", \"%s\"], \"equity\": %.9f, \"wins\": %.17g, "
+                       "\"ties\": %.17g, \"losses\": %.17g, \"runouts\": %lu, \"seconds\": %.3f}\n",
+                       range_texts[0], range_texts[1], share, result.wins, result.ties,
+                       result.losses, result.runouts, seconds);
+        }
+
+        free(ranges);
+        return 0;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "hash_eval.c"
+
+// Omaha evaluation: the best hand made of exactly two hole cards and exactly three board cards.
+// A five-card hand's rank key is the sum of its cards' HASH_RANK_KEYS, so the key of every board
+// triple is summed once per board, and every hole pair then adds its own key to each of them: one
+// add and one rank_scores load per combination instead of a full evaluation. A combination can
+// only be a flush when both hole cards and all three board cards share a suit, so flush scores
+// are only looked up for the board triples of a suited hole pair's suit.
+
+#define MAX_OMAHA_TRIPLES 10 // 5 choose 3
+#define MAX_OMAHA_HOLE_CARDS 6
+
+struct OmahaBoard {
+        Card board;
+        // Rank key sum of every three-card subset of the board
+        uint32_t num_triples;
+        uint32_t triple_keys[MAX_OMAHA_TRIPLES];
+        // Rank masks of the subsets whose three cards are all of one suit, by suit
+        uint32_t num_suited_triples[4];
+        uint16_t suited_triples[4][MAX_OMAHA_TRIPLES];
+};
+
+/**
+ * Analyses a board of three to five cards
+ */
+void omaha_board_init(struct OmahaBoard *state, Card board) {
+        Card cards[5];
+        uint32_t n = 0;
+        for (Card rest = board; rest && n < 5; rest &= rest - 1) {
+                cards[n++] = rest & -rest;
+        }
+
+        state->board = board;
+        state->num_triples = 0;
+        memset(state->num_suited_triples, 0, sizeof(state->num_suited_triples));
+        for (uint32_t i = 0; i < n; i += 1) {
+                for (uint32_t j = i + 1; j < n; j += 1) {
+                        for (uint32_t k = j + 1; k < n; k += 1) {
+                                uint32_t bits[3] = {__builtin_ctzll(cards[i]),
+                                                    __builtin_ctzll(cards[j]),
+                                                    __builtin_ctzll(cards[k])};
+                                state->triple_keys[state->num_triples++] =
+                                    HASH_RANK_KEYS[bits[0] % 16] + HASH_RANK_KEYS[bits[1] % 16] +
+                                    HASH_RANK_KEYS[bits[2] % 16];
+
+                                uint32_t suit = bits[0] / 16;
+                                if (bits[1] / 16 == suit && bits[2] / 16 == suit) {
+                                        uint32_t *count = &state->num_suited_triples[suit];
+                                        state->suited_triples[suit][(*count)++] =
+                                            (1 << bits[0] % 16) | (1 << bits[1] % 16) |
+                                            (1 << bits[2] % 16);
+                                }
+                        }
+                }
+        }
+}
+
+/**
+ * Scores the best hand of two of the hole cards and three of the board's, with the same result
+ * as the best eval_hand over every such five cards. Takes two to six hole cards. Requires
+ * init_hash_eval.
+ */
+uint32_t omaha_eval_finish(const struct OmahaBoard *state, Card hole) {
+        const struct HashEvalTable *t = hash_eval_table;
+        uint32_t bits[MAX_OMAHA_HOLE_CARDS];
+        uint32_t n = 0;
+        for (; hole && n < MAX_OMAHA_HOLE_CARDS; hole &= hole - 1) {
+                bits[n++] = __builtin_ctzll(hole);
+        }
+
+        uint32_t best = UINT32_MAX;
+        for (uint32_t i = 0; i < n; i += 1) {
+                for (uint32_t j = i + 1; j < n; j += 1) {
+                        uint32_t key = HASH_RANK_KEYS[bits[i] % 16] + HASH_RANK_KEYS[bits[j] % 16];
+                        for (uint32_t k = 0; k < state->num_triples; k += 1) {
+                                uint32_t score = t->rank_scores[key + state->triple_keys[k]];
+                                best = score < best ? score : best;
+                        }
+
+                        uint32_t suit = bits[i] / 16;
+                        if (bits[j] / 16 != suit) {
+                                continue;
+                        }
+                        uint32_t pair = (1 << bits[i] % 16) | (1 << bits[j] % 16);
+                        const uint16_t *triples = state->suited_triples[suit];
+                        for (uint32_t k = 0; k < state->num_suited_triples[suit]; k += 1) {
+                                uint32_t score = t->flush_scores[pair | triples[k]];
+                                best = score < best ? score : best;
+                        }
+                }
+        }
+
+        return best;
+}
+
+/**
+ * Scores an Omaha hand: two to six hole cards, of which exactly two are used, and three to five
+ * board cards, of which exactly three are used. Requires init_hash_eval.
+ */
+uint32_t eval_omaha(Card hole, Card board) {
+        struct OmahaBoard state;
+        omaha_board_init(&state, board);
+        return omaha_eval_finish(&state, hole);
+}
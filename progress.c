@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+// Throttled progress on stderr. Updates may come from any thread, as often as convenient; at most
+// `progress_rate` of them a second are printed, each with an ETA from the average rate so far.
+
+double progress_rate = 2.0;
+
+struct Progress {
+        const char *label;
+        uint64_t total;
+        // Work already done when the phase started (e.g. resumed from a checkpoint), which
+        // doesn't count towards the rate
+        uint64_t initial;
+        double start;
+        double last_report;
+        int reporting;
+};
+
+double monotonic_seconds() {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+void progress_init(struct Progress *progress, const char *label, uint64_t initial,
+                   uint64_t total) {
+        progress->label = label;
+        progress->total = total;
+        progress->initial = initial;
+        progress->start = monotonic_seconds();
+        progress->last_report = 0.0;
+        progress->reporting = 0;
+}
+
+void progress_print(struct Progress *progress, uint64_t done, double now) {
+        double elapsed = now - progress->start;
+        double rate = done > progress->initial ? (done - progress->initial) / elapsed : 0.0;
+        double eta = rate > 0.0 ? (progress->total - done) / rate : 0.0;
+
+        fprintf(stderr, "\r%s %lu/%lu (%.1f%%), %.0fs elapsed, ETA %.0fs ", progress->label, done,
+                progress->total, 100.0 * done / progress->total, elapsed, eta);
+}
+
+/**
+ * Reports that `done` of the total are finished, if enough time has passed since the last report
+ */
+void progress_update(struct Progress *progress, uint64_t done) {
+        // Every thread checks the time of the last report, but only the one reporting writes it
+        double now = monotonic_seconds();
+        double last_report;
+        __atomic_load(&progress->last_report, &last_report, __ATOMIC_RELAXED);
+        if (now - last_report < 1.0 / progress_rate ||
+            __atomic_exchange_n(&progress->reporting, 1, __ATOMIC_ACQUIRE)) {
+                return;
+        }
+
+        progress_print(progress, done, now);
+        __atomic_store(&progress->last_report, &now, __ATOMIC_RELAXED);
+        __atomic_store_n(&progress->reporting, 0, __ATOMIC_RELEASE);
+}
+
+void progress_finish(struct Progress *progress) {
+        progress_print(progress, progress->total, monotonic_seconds());
+        fprintf(stderr, "\n");
+}
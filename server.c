@@ -0,0 +1,352 @@
+#pragma once
+
+#include "equity.c"
+#include "montecarlo.c"
+
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+// Query server. One process keeps the evaluator tables and an LRU of solved hands resident and
+// answers one query per line, over stdin/stdout or a Unix socket:
+//
+//     AhKd                 preflop: EVs of 4x, 3x and check
+//     AhKd Ts9s2c          flop, after checking preflop: EVs of 2x and check
+//     AhKd Ts9s2c 4h5d     river, after checking twice: EVs of 1x and fold
+//
+// Each answer is one line of JSON. Hole cards are relabelled onto the suits their starting hand
+// was solved with (see starting_hand_cards), and the board with them, so all 1326 hole cards
+// share the 169 solutions.
+
+#define DEFAULT_LRU_CAPACITY 16
+#define MAX_QUERY_RESPONSE 512
+
+struct CachedSolution {
+        struct Solution solution;
+        uint64_t last_used;
+};
+
+// The most recently used solved hands, and where their runout tables are kept
+struct SolutionCache {
+        const char *cache_directory;
+        uint32_t capacity;
+        uint32_t size;
+        uint64_t clock;
+        struct CachedSolution *entries;
+};
+
+bool init_solution_cache(struct SolutionCache *cache, uint32_t capacity,
+                         const char *cache_directory) {
+        cache->cache_directory = cache_directory;
+        cache->capacity = capacity ? capacity : 1;
+        cache->size = 0;
+        cache->clock = 0;
+        cache->entries = calloc(cache->capacity, sizeof(struct CachedSolution));
+        return cache->entries != NULL;
+}
+
+void free_solution_cache(struct SolutionCache *cache) {
+        for (uint32_t i = 0; i < cache->size; i += 1) {
+                free_solution(&cache->entries[i].solution);
+        }
+        free(cache->entries);
+}
+
+/**
+ * Returns the solution of `hand`, solving it and evicting the least recently used one on a miss.
+ * Returns NULL if it can't be solved.
+ */
+const struct Solution *cached_solution(struct SolutionCache *cache, Card hand) {
+        cache->clock += 1;
+        uint32_t slot = 0;
+        for (uint32_t i = 0; i < cache->size; i += 1) {
+                if (cache->entries[i].solution.hand == hand) {
+                        cache->entries[i].last_used = cache->clock;
+                        return &cache->entries[i].solution;
+                }
+                if (cache->entries[i].last_used < cache->entries[slot].last_used) {
+                        slot = i;
+                }
+        }
+
+        if (cache->size < cache->capacity) {
+                slot = cache->size;
+        } else {
+                free_solution(&cache->entries[slot].solution);
+                cache->size -= 1;
+                if (slot != cache->size) {
+                        cache->entries[slot] = cache->entries[cache->size];
+                }
+                slot = cache->size;
+        }
+
+        char name[4];
+        char runout_path[4096];
+        starting_hand_name(hand, name);
+        struct SolveFiles files = {NULL, NULL, false, false};
+        if (cache->cache_directory) {
+                snprintf(runout_path, sizeof(runout_path), "%s/runout-%s.tbl",
+                         cache->cache_directory, name);
+                files.runout_path = runout_path;
+        }
+
+        struct CachedSolution *entry = &cache->entries[slot];
+        if (!solve_hand(hand, &files, &entry->solution)) {
+                return NULL;
+        }
+        entry->last_used = cache->clock;
+        cache->size += 1;
+        return &entry->solution;
+}
+
+/**
+ * Answers one query line into `response` as a line of JSON. Returns false, with an error
+ * response, if the query is invalid or can't be solved.
+ */
+bool answer_query(struct SolutionCache *cache, const char *query, char *response, size_t size) {
+        char hole_text[8] = "", flop_text[8] = "", river_text[8] = "", extra[2] = "";
+        int fields = sscanf(query, "%7s %7s %7s %1s", hole_text, flop_text, river_text, extra);
+
+        Card hole, flop = 0, river = 0;
+        if (fields < 1 || fields > 3 || strlen(hole_text) != 4 ||
+            !parse_cards(hole_text, 2, &hole) ||
+            (fields >= 2 && (strlen(flop_text) != 6 || !parse_cards(flop_text, 3, &flop))) ||
+            (fields == 3 && (strlen(river_text) != 4 || !parse_cards(river_text, 2, &river))) ||
+            (hole & flop) || ((hole | flop) & river)) {
+                snprintf(response, size, "{\"error\": \"invalid query\"}\n");
+                return false;
+        }
+
+        Card board = flop | river;
+        Card hand = normalize_suits(hole, &board);
+        const struct Solution *solution = cached_solution(cache, hand);
+        if (!solution) {
+                snprintf(response, size, "{\"error\": \"could not solve\"}\n");
+                return false;
+        }
+
+        char name[4];
+        starting_hand_name(hand, name);
+        if (fields == 1) {
+                snprintf(response, size,
+                         "{\"hand\": \"%s\", \"street\": \"preflop\", \"evs\": {\"4x\": %.9f, "
+                         "\"3x\": %.9f, \"check\": %.9f}, \"decision\": \"%s\"}\n",
+                         name, solution->raise4_ev, solution->raise3_ev, solution->check_ev,
+                         ACTION_NAMES[solution->action]);
+        } else if (fields == 2) {
+                const struct FlopNode *node = find_flop_node(solution, board);
+                snprintf(response, size,
+                         "{\"hand\": \"%s\", \"street\": \"flop\", \"evs\": {\"2x\": %.9f, "
+                         "\"check\": %.9f}, \"decision\": \"%s\"}\n",
+                         name, flop_node_ev(node->bet_total), flop_node_ev(node->check_total),
+                         ACTION_NAMES[node->action]);
+        } else {
+                struct BoardOutcome outcome = find_board_outcome(solution, board);
+                int64_t value;
+                enum Action action = river_decision(outcome, &value);
+                double scale = (double)HALF_UNITS * NUM_DEALER_HOLES;
+                snprintf(response, size,
+                         "{\"hand\": \"%s\", \"street\": \"river\", \"evs\": {\"1x\": %.9f, "
+                         "\"fold\": %.9f}, \"decision\": \"%s\"}\n",
+                         name, outcome_payout(outcome, 1) / scale, -(ANTE + BLIND),
+                         ACTION_NAMES[action]);
+        }
+        return true;
+}
+
+/**
+ * Answers every query line from `in` on `out` until end of input
+ */
+void serve_stream(struct SolutionCache *cache, FILE *in, FILE *out) {
+        char *line = NULL;
+        size_t capacity = 0;
+        char response[MAX_QUERY_RESPONSE];
+
+        while (getline(&line, &capacity, in) != -1) {
+                if (line[strspn(line, " \t\r\n")] == '\0') {
+                        continue;
+                }
+                answer_query(cache, line, response, sizeof(response));
+                if (fputs(response, out) == EOF || fflush(out) == EOF) {
+                        break;
+                }
+        }
+        free(line);
+}
+
+/**
+ * Serves clients of a Unix socket at `path` one connection at a time, forever. Returns false if
+ * the socket can't be set up.
+ */
+bool serve_socket(struct SolutionCache *cache, const char *path) {
+        struct sockaddr_un address = {.sun_family = AF_UNIX};
+        if (strlen(path) >= sizeof(address.sun_path)) {
+                fprintf(stderr, "Socket path %s is too long\n", path);
+                return false;
+        }
+        strcpy(address.sun_path, path);
+
+        int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        unlink(path);
+        if (listener < 0 || bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+            listen(listener, 16) != 0) {
+                fprintf(stderr, "Could not listen on %s\n", path);
+                return false;
+        }
+
+        // A client hanging up mid-answer shouldn't take the server down
+        signal(SIGPIPE, SIG_IGN);
+        fprintf(stderr, "Listening on %s\n", path);
+        for (;;) {
+                int client = accept(listener, NULL, NULL);
+                if (client < 0) {
+                        continue;
+                }
+
+                FILE *in = fdopen(client, "r");
+                FILE *out = fdopen(dup(client), "w");
+                if (in && out) {
+                        serve_stream(cache, in, out);
+                }
+                if (in) {
+                        fclose(in);
+                }
+                if (out) {
+                        fclose(out);
+                }
+        }
+}
+
+/**
+ * Connects to a query server's Unix socket. Returns -1 on failure.
+ */
+int connect_socket(const char *path) {
+        struct sockaddr_un address = {.sun_family = AF_UNIX};
+        snprintf(address.sun_path, sizeof(address.sun_path), "%s", path);
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0) {
+                close(fd);
+                fd = -1;
+        }
+        return fd;
+}
+
+/**
+ * Writes a random query for one of `hands` into `query`: random hole cards of the starting hand,
+ * and an empty, flop or full board
+ */
+void random_query(struct Xoshiro256 *rng, const Card *hands, uint32_t num_hands, char *query) {
+        Card hand = hands[xoshiro_next(rng) % num_hands];
+        uint8_t permutation[4] = {0, 1, 2, 3};
+        for (uint32_t i = 3; i > 0; i -= 1) {
+                uint32_t j = xoshiro_next(rng) % (i + 1);
+                uint8_t swap = permutation[i];
+                permutation[i] = permutation[j];
+                permutation[j] = swap;
+        }
+        Card hole = permute_suits(hand, permutation);
+
+        char hole_text[5], flop_text[7], river_text[5];
+        format_cards(hole, hole_text);
+        uint32_t street = xoshiro_next(rng) % 3;
+        if (street == 0) {
+                sprintf(query, "%s\n", hole_text);
+                return;
+        }
+
+        Card flop = draw_cards(rng, hole, 3);
+        format_cards(flop, flop_text);
+        if (street == 1) {
+                sprintf(query, "%s %s\n", hole_text, flop_text);
+                return;
+        }
+
+        format_cards(draw_cards(rng, hole | flop, 2), river_text);
+        sprintf(query, "%s %s %s\n", hole_text, flop_text, river_text);
+}
+
+int compare_latencies(const void *a, const void *b) {
+        double x = *(const double *)a;
+        double y = *(const double *)b;
+        return x < y ? -1 : x > y;
+}
+
+/**
+ * Sends `queries` random queries for `hands`, one at a time, to the server at `socket_path`, or
+ * straight to `cache` in this process if it is NULL, and prints latency percentiles. Each hand is
+ * queried once first, unmeasured, so only cached states are timed. Returns false on any failure.
+ */
+bool run_load_test(struct SolutionCache *cache, const char *socket_path, const Card *hands,
+                   uint32_t num_hands, uint64_t queries) {
+        FILE *in = NULL, *out = NULL;
+        if (socket_path) {
+                int fd = connect_socket(socket_path);
+                in = fd >= 0 ? fdopen(fd, "r") : NULL;
+                out = fd >= 0 ? fdopen(dup(fd), "w") : NULL;
+                if (!in || !out) {
+                        fprintf(stderr, "Could not connect to %s\n", socket_path);
+                        return false;
+                }
+        }
+
+        double *latencies = malloc(queries * sizeof(double));
+        char query[32], response[MAX_QUERY_RESPONSE];
+        char *line = NULL;
+        size_t capacity = 0;
+        struct Xoshiro256 rng;
+        xoshiro_seed(&rng, 1, 0);
+        bool ok = latencies != NULL;
+
+        for (uint64_t i = 0; ok && i < num_hands + queries; i += 1) {
+                if (i < num_hands) {
+                        char name[5];
+                        format_cards(hands[i], name);
+                        snprintf(query, sizeof(query), "%s\n", name);
+                } else {
+                        random_query(&rng, hands, num_hands, query);
+                }
+
+                struct timespec start, end;
+                clock_gettime(CLOCK_MONOTONIC, &start);
+                if (socket_path) {
+                        ok = fputs(query, out) != EOF && fflush(out) != EOF &&
+                             getline(&line, &capacity, in) != -1 && !strstr(line, "\"error\"");
+                } else {
+                        ok = answer_query(cache, query, response, sizeof(response));
+                }
+                clock_gettime(CLOCK_MONOTONIC, &end);
+
+                if (i >= num_hands) {
+                        latencies[i - num_hands] =
+                            (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3;
+                }
+                if (!ok) {
+                        fprintf(stderr, "Query failed: %s", query);
+                }
+        }
+
+        if (ok) {
+                double total = 0.0;
+                for (uint64_t i = 0; i < queries; i += 1) {
+                        total += latencies[i];
+                }
+                qsort(latencies, queries, sizeof(double), compare_latencies);
+                printf("%lu queries %s: mean %.2fus, p50 %.2fus, p90 %.2fus, p99 %.2fus, "
+                       "p99.9 %.2fus, max %.2fus\n",
+                       queries, socket_path ? "over the socket" : "in process", total / queries,
+                       latencies[queries / 2], latencies[queries * 9 / 10],
+                       latencies[queries * 99 / 100], latencies[queries * 999 / 1000],
+                       latencies[queries - 1]);
+        }
+
+        free(line);
+        free(latencies);
+        if (in) {
+                fclose(in);
+                fclose(out);
+        }
+        return ok;
+}
@@ -0,0 +1,273 @@
+#pragma once
+
+#include "solver.c"
+
+#include <stdlib.h>
+
+// Splitting one solve across processes or machines. Shard i of N solves only its contiguous
+// range of runout chunks, or of flops once the runout is merged, and saves exact integer totals
+// and the outcomes or nodes of its range to its own file. Ranges only depend on i and N, and
+// totals are integers summed in any order, so merging the files of every shard gives exactly the
+// tables and EVs of solving in one process.
+
+// Bump whenever the shard file layouts change
+const uint32_t SHARD_VERSION = 1;
+
+#define RUNOUT_SHARD_KIND "runout-shard"
+#define FLOP_SHARD_KIND "flop-shard"
+
+// One shard's part of a runout table
+struct RunoutShard {
+        uint32_t version;
+        uint32_t shard;
+        uint32_t num_shards;
+        uint32_t canonical_boards;
+        Card hand;
+        int64_t raise4_total;
+        int64_t raise3_total;
+        // The outcomes of the boards in the shard's chunks, in colex order
+        struct BoardOutcome board_outcomes[];
+};
+
+// One shard's part of a flop sweep
+struct FlopShard {
+        uint32_t version;
+        uint32_t shard;
+        uint32_t num_shards;
+        uint32_t padding;
+        Card hand;
+        int64_t check_total;
+        // The nodes of the shard's flops, in colex order
+        struct FlopNode flop_nodes[];
+};
+
+/**
+ * Parses a shard spec like "2/8", the second of eight, into a zero-based shard. Returns false if
+ * it isn't a valid spec.
+ */
+bool parse_shard(const char *spec, uint32_t *shard, uint32_t *num_shards) {
+        char *end;
+        unsigned long index = strtoul(spec, &end, 10);
+        if (end == spec || *end != '/') {
+                return false;
+        }
+
+        const char *count = end + 1;
+        unsigned long total = strtoul(count, &end, 10);
+        if (end == count || *end != '\0' || index < 1 || index > total ||
+            total > NUM_RUNOUT_CHUNKS) {
+                return false;
+        }
+
+        *shard = index - 1;
+        *num_shards = total;
+        return true;
+}
+
+/**
+ * Returns the first of `total` items in shard `shard` of `num_shards`. Shard num_shards starts
+ * at `total`, so each shard ends where the next one starts.
+ */
+uint32_t shard_start(uint32_t total, uint32_t shard, uint32_t num_shards) {
+        return (uint64_t)total * shard / num_shards;
+}
+
+/**
+ * Returns the first board in runout chunk `chunk`, or NUM_BOARDS past the last chunk
+ */
+uint32_t chunk_board(uint32_t chunk) {
+        uint64_t board = (uint64_t)chunk * RUNOUT_CHUNK_SIZE;
+        return board < NUM_BOARDS ? board : NUM_BOARDS;
+}
+
+/**
+ * Returns the first board in shard `shard` of `num_shards` of the runout
+ */
+uint32_t runout_shard_board(uint32_t shard, uint32_t num_shards) {
+        return chunk_board(shard_start(NUM_RUNOUT_CHUNKS, shard, num_shards));
+}
+
+/**
+ * Saves the solution's runout table as shard `shard` of `num_shards`: its header totals, which
+ * must only cover the shard's chunks, and the outcomes of the shard's boards. Returns false on
+ * any I/O error.
+ */
+bool save_runout_shard(const struct Solution *solution, uint32_t shard, uint32_t num_shards,
+                       const char *path) {
+        const struct RunoutTable *table = solution->runout;
+        uint32_t first = runout_shard_board(shard, num_shards);
+        uint32_t end = runout_shard_board(shard + 1, num_shards);
+        uint64_t size = sizeof(struct RunoutShard) + (end - first) * sizeof(struct BoardOutcome);
+
+        struct RunoutShard *file = malloc(size);
+        if (!file) {
+                return false;
+        }
+        memset(file, 0, sizeof(struct RunoutShard));
+        file->version = SHARD_VERSION;
+        file->shard = shard;
+        file->num_shards = num_shards;
+        file->canonical_boards = table->canonical_boards;
+        file->hand = solution->hand;
+        file->raise4_total = table->raise4_total;
+        file->raise3_total = table->raise3_total;
+        memcpy(file->board_outcomes, &table->board_outcomes[first],
+               (end - first) * sizeof(struct BoardOutcome));
+
+        bool ok = write_table_file(path, RUNOUT_SHARD_KIND, EVAL_VERSION, file, size);
+        free(file);
+        return ok;
+}
+
+/**
+ * Builds the runout chunks of shard `shard` of `num_shards` and saves them to `path`. Returns
+ * false if the tables can't be allocated or saved.
+ */
+bool solve_runout_shard(Card hand, uint32_t shard, uint32_t num_shards, const char *path) {
+        struct Solution solution;
+        struct SolveFiles files = {NULL, NULL, false, false};
+        bool ok = init_solution(&solution, hand) &&
+                  simulate_runout(&solution, &files,
+                                  shard_start(NUM_RUNOUT_CHUNKS, shard, num_shards),
+                                  shard_start(NUM_RUNOUT_CHUNKS, shard + 1, num_shards)) &&
+                  save_runout_shard(&solution, shard, num_shards, path);
+        free_solution(&solution);
+        return ok;
+}
+
+/**
+ * Assembles the solution's runout table from the files of every shard, in `paths` by shard.
+ * Returns false if any of them is missing, stale, from another split or corrupt.
+ */
+bool merge_runout_shards(struct Solution *solution, const char *const *paths,
+                         uint32_t num_shards) {
+        struct RunoutTable *table = malloc(sizeof(struct RunoutTable));
+        if (!table) {
+                fprintf(stderr, "Could not allocate solver tables\n");
+                return false;
+        }
+        memset(table, 0, offsetof(struct RunoutTable, board_outcomes));
+        table->version = RUNOUT_TABLE_VERSION;
+        table->hand = solution->hand;
+        table->chunks_done = NUM_RUNOUT_CHUNKS;
+
+        for (uint32_t shard = 0; shard < num_shards; shard += 1) {
+                uint32_t first = runout_shard_board(shard, num_shards);
+                uint32_t end = runout_shard_board(shard + 1, num_shards);
+                uint64_t size;
+                const struct RunoutShard *file =
+                    map_table_file(paths[shard], RUNOUT_SHARD_KIND, EVAL_VERSION, &size);
+                bool ok = file && file->version == SHARD_VERSION && file->shard == shard &&
+                          file->num_shards == num_shards && file->hand == solution->hand &&
+                          size == sizeof(struct RunoutShard) +
+                                      (end - first) * sizeof(struct BoardOutcome);
+                if (ok) {
+                        table->raise4_total += file->raise4_total;
+                        table->raise3_total += file->raise3_total;
+                        table->canonical_boards += file->canonical_boards;
+                        memcpy(&table->board_outcomes[first], file->board_outcomes,
+                               (end - first) * sizeof(struct BoardOutcome));
+                }
+                if (file) {
+                        unmap_table_file(file, size);
+                }
+                if (!ok) {
+                        fprintf(stderr, "No usable runout shard %u/%u at %s\n", shard + 1,
+                                num_shards, paths[shard]);
+                        free(table);
+                        return false;
+                }
+        }
+
+        solution->runout = table;
+        solution->runout_mapped = false;
+        return true;
+}
+
+/**
+ * Saves the solution's flop nodes and check total as shard `shard` of `num_shards`. The total
+ * must only cover the shard's flops. Returns false on any I/O error.
+ */
+bool save_flop_shard(const struct Solution *solution, uint32_t shard, uint32_t num_shards,
+                     const char *path) {
+        uint32_t first = shard_start(NUM_FLOPS, shard, num_shards);
+        uint32_t end = shard_start(NUM_FLOPS, shard + 1, num_shards);
+        uint64_t size = sizeof(struct FlopShard) + (end - first) * sizeof(struct FlopNode);
+
+        struct FlopShard *file = malloc(size);
+        if (!file) {
+                return false;
+        }
+        memset(file, 0, sizeof(struct FlopShard));
+        file->version = SHARD_VERSION;
+        file->shard = shard;
+        file->num_shards = num_shards;
+        file->hand = solution->hand;
+        file->check_total = solution->check_total;
+        memcpy(file->flop_nodes, &solution->flop_nodes[first],
+               (end - first) * sizeof(struct FlopNode));
+
+        bool ok = write_table_file(path, FLOP_SHARD_KIND, EVAL_VERSION, file, size);
+        free(file);
+        return ok;
+}
+
+/**
+ * Solves the flops of shard `shard` of `num_shards` from the finished runout table at
+ * `runout_path`, and saves their nodes and total to `path`. Returns false if there is no such
+ * table, or the tables can't be allocated or saved.
+ */
+bool solve_flop_shard(Card hand, uint32_t shard, uint32_t num_shards, const char *runout_path,
+                      const char *path) {
+        struct Solution solution;
+        if (!init_solution(&solution, hand)) {
+                return false;
+        }
+        if (!load_runout_table(&solution, runout_path)) {
+                fprintf(stderr, "No finished runout table at %s\n", runout_path);
+                free_solution(&solution);
+                return false;
+        }
+
+        struct SolveFiles files = {NULL, NULL, false, false};
+        simulate_flop(&solution, &files, shard_start(NUM_FLOPS, shard, num_shards),
+                      shard_start(NUM_FLOPS, shard + 1, num_shards));
+        bool ok = save_flop_shard(&solution, shard, num_shards, path);
+        free_solution(&solution);
+        return ok;
+}
+
+/**
+ * Assembles the solution's flop nodes and check total from the files of every shard, in `paths`
+ * by shard. Returns false if any of them is missing, stale, from another split or corrupt.
+ */
+bool merge_flop_shards(struct Solution *solution, const char *const *paths, uint32_t num_shards) {
+        int64_t total = 0;
+        for (uint32_t shard = 0; shard < num_shards; shard += 1) {
+                uint32_t first = shard_start(NUM_FLOPS, shard, num_shards);
+                uint32_t end = shard_start(NUM_FLOPS, shard + 1, num_shards);
+                uint64_t size;
+                const struct FlopShard *file =
+                    map_table_file(paths[shard], FLOP_SHARD_KIND, EVAL_VERSION, &size);
+                bool ok = file && file->version == SHARD_VERSION && file->shard == shard &&
+                          file->num_shards == num_shards && file->hand == solution->hand &&
+                          size == sizeof(struct FlopShard) +
+                                      (end - first) * sizeof(struct FlopNode);
+                if (ok) {
+                        total += file->check_total;
+                        memcpy(&solution->flop_nodes[first], file->flop_nodes,
+                               (end - first) * sizeof(struct FlopNode));
+                }
+                if (file) {
+                        unmap_table_file(file, size);
+                }
+                if (!ok) {
+                        fprintf(stderr, "No usable flop shard %u/%u at %s\n", shard + 1,
+                                num_shards, paths[shard]);
+                        return false;
+                }
+        }
+
+        solution->check_total = total;
+        return true;
+}
@@ -0,0 +1,785 @@
+#pragma once
+
+#include "board_eval.c"
+#include "canonical.c"
+#include "combination.c"
+#include "dispatch.c"
+#include "engine.c"
+#include "progress.c"
+#include "table_file.c"
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+// Ultimate Texas Hold'em decision tree, solved exactly for one starting hand:
+//
+//   preflop: raise 4x, raise 3x, or check
+//   flop (after a check): bet 2x, or check
+//   river (after two checks): bet 1x, or fold
+//
+// River nodes only depend on the five board cards, and are memoized per canonical board in
+// the runout table. Flop nodes only depend on the flop, and are memoized per canonical flop in
+// flop_nodes. Every other board or flop is looked up through its canonical member.
+//
+// Payouts are counted in half units of the ante, the smallest stake every payout is a multiple of
+// (a flush blind pays 3 to 2), so all totals are exact integers until the final EV division.
+//
+// The runout table only depends on the hole cards, so it can be saved after a solve and mapped
+// back in later instead of running the runout phase again. Long solves can also checkpoint the
+// runout table and flop sweep as they go, and resume from them after being killed. Every total is
+// an exact integer, so a resumed solve gives the same result as an uninterrupted one.
+
+const double ANTE = 1.0;
+const double BLIND = 1.0;
+
+#define HALF_UNITS 2
+
+#define NUM_BOARDS 2118760   // 50 choose 5
+#define NUM_FLOPS 19600      // 50 choose 3
+#define NUM_TURN_RIVERS 1081 // 47 choose 2
+#define NUM_DEALER_HOLES 990 // 45 choose 2
+
+enum Action {
+        ACTION_RAISE_4X,
+        ACTION_RAISE_3X,
+        ACTION_CHECK,
+        ACTION_BET_2X,
+        ACTION_BET_1X,
+        ACTION_FOLD,
+        NUM_ACTIONS
+};
+
+const char *ACTION_NAMES[NUM_ACTIONS] = {"4x", "3x", "check", "2x", "1x", "fold"};
+
+// How the player's hand fares against all 990 dealer holes on one board, packed into 4 bytes:
+// the total ante and blind payout in half units, and wins minus losses, which is what each unit
+// of play bet adds. Every bet size's payout is exact from these two. The base is at most
+// 990 * 2 * 501 for a royal flush winning every hand, which fits the 21 signed bits.
+struct BoardOutcome {
+        int32_t base : 21;
+        int32_t net_wins : 11;
+};
+
+// The flop decision after a preflop check. Totals are in half units over every turn, river and
+// dealer hole; weight is the size of the flop's suit-isomorphism class, or 0 if the flop isn't
+// canonical and wasn't solved. river_folds counts the turn/river boards where the river
+// decision after checking the flop is to fold.
+struct FlopNode {
+        int64_t bet_total;
+        int64_t check_total;
+        uint32_t weight;
+        uint16_t river_folds;
+        uint8_t action;
+};
+
+// Bump whenever the runout table layout or the payouts it holds change, so saved tables are
+// rebuilt
+const uint32_t RUNOUT_TABLE_VERSION = 2;
+
+// Bump whenever the flop checkpoint layout or the flop nodes it holds change. The nodes are built
+// from the runout table, so bump it along with RUNOUT_TABLE_VERSION too.
+const uint32_t FLOP_CHECKPOINT_VERSION = 1;
+
+#define RUNOUT_TABLE_KIND "runout"
+#define FLOP_CHECKPOINT_KIND "flop"
+
+// Everything the runout phase computes for one pair of hole cards, in the saved file layout
+struct RunoutTable {
+        uint32_t version;
+        uint32_t canonical_boards;
+        Card hand;
+        // Exact totals in half units of raising 4x and 3x preflop, weighted over every board
+        int64_t raise4_total;
+        int64_t raise3_total;
+        // Chunks of boards covered by the totals and outcomes. A checkpoint of an unfinished
+        // runout only saves the outcomes of these.
+        uint32_t chunks_done;
+        uint32_t padding;
+        // Indexed by the colex rank of the board among the cards left after the hole cards
+        struct BoardOutcome board_outcomes[NUM_BOARDS];
+};
+
+// A checkpoint of the flop sweep: every flop before next_flop is solved
+struct FlopCheckpoint {
+        uint32_t version;
+        uint32_t next_flop;
+        Card hand;
+        int64_t check_total;
+        struct FlopNode flop_nodes[NUM_FLOPS];
+};
+
+// Where solve_hand keeps its files. Either path may be NULL.
+struct SolveFiles {
+        // A finished runout table here is reused, and a freshly built one saved
+        const char *runout_path;
+        // With `checkpoint`, unfinished runout tables and flop sweeps are saved to runout_path
+        // and flop_path every checkpoint_interval seconds. With `resume`, they are picked up
+        // again.
+        const char *flop_path;
+        bool checkpoint;
+        bool resume;
+};
+
+// The solved tree of one starting hand. Each solution owns its tables, so several hands can be
+// solved side by side.
+struct Solution {
+        Card hand;
+        uint64_t deck;
+        struct SuitSymmetry symmetry;
+
+        // Either built by simulate_runout or mapped from a saved file
+        const struct RunoutTable *runout;
+        bool runout_mapped;
+
+        // Indexed by the colex rank of the flop among the cards in deck
+        struct FlopNode *flop_nodes;
+
+        // Exact total in half units of checking preflop, weighted over every flop
+        int64_t check_total;
+
+        double raise4_ev;
+        double raise3_ev;
+        double check_ev;
+        enum Action action;
+};
+
+// Boards are split into fixed-size chunks whose totals are summed in chunk order, so the result
+// doesn't depend on how many threads ran them
+#define RUNOUT_CHUNK_SIZE 4096
+#define NUM_RUNOUT_CHUNKS ((NUM_BOARDS + RUNOUT_CHUNK_SIZE - 1) / RUNOUT_CHUNK_SIZE)
+
+uint32_t num_threads = 1;
+
+double checkpoint_interval = 60.0;
+
+double max(double a, double b) { return a > b ? a : b; }
+
+int64_t max_int64(int64_t a, int64_t b) { return a > b ? a : b; }
+
+double blind_payout(uint32_t score) {
+        if (score == 0) { // royal flush
+                return 500.0;
+        } else if (score < STRAIGHT_FLUSH_INDEX + NUM_STRAIGHT_FLUSHES) {
+                return 50.0;
+        } else if (score < FOUR_OF_A_KIND_INDEX + NUM_FOUR_OF_A_KINDS) {
+                return 10.0;
+        } else if (score < FLUSH_INDEX + NUM_FLUSHES) {
+                return 1.5;
+        } else if (score < STRAIGHT_INDEX + NUM_STRAIGHTS) {
+                return 1.0;
+        } else {
+                // did not qualify
+                return 0.0;
+        }
+}
+
+/**
+ * Packs the dealer hole counts of one board into a BoardOutcome. Pushes are whatever is left over.
+ */
+struct BoardOutcome board_outcome(uint32_t wins_qualified, uint32_t wins_unqualified,
+                                  uint32_t losses, uint32_t player_score) {
+        int32_t ante = HALF_UNITS * ANTE;
+        int32_t blind = HALF_UNITS * blind_payout(player_score);
+        int32_t lose = HALF_UNITS * (ANTE + BLIND);
+
+        struct BoardOutcome outcome;
+        outcome.base = wins_qualified * (ante + blind) + wins_unqualified * blind - losses * lose;
+        outcome.net_wins = (int32_t)(wins_qualified + wins_unqualified) - (int32_t)losses;
+        return outcome;
+}
+
+/**
+ * Returns the total payout in half units of a play bet of `bet` antes against every dealer hole
+ */
+int64_t outcome_payout(struct BoardOutcome outcome, uint32_t bet) {
+        return outcome.base + (int64_t)HALF_UNITS * bet * outcome.net_wins;
+}
+
+/**
+ * Returns the best river action for a board, and stores its total payout in half units over
+ * every dealer hole in `value`. Folding forfeits the ante and blind against each of them.
+ */
+enum Action river_decision(struct BoardOutcome outcome, int64_t *value) {
+        int64_t bet = outcome_payout(outcome, 1);
+        int64_t fold = -HALF_UNITS * (ANTE + BLIND) * NUM_DEALER_HOLES;
+
+        *value = max_int64(bet, fold);
+        return bet >= fold ? ACTION_BET_1X : ACTION_FOLD;
+}
+
+/**
+ * Returns the hole cards used to solve a starting hand: the first card is a heart, and the
+ * second a diamond unless the hand is suited
+ */
+Card starting_hand_cards(char first_rank, char second_rank, bool suited) {
+        char card[3] = "_h\0";
+        card[0] = first_rank;
+        Card first_card = create_card(card);
+
+        card[0] = second_rank;
+        card[1] = suited ? 'h' : 'd';
+        return first_card | create_card(card);
+}
+
+/**
+ * Writes the starting hand of two hole cards, like "AKo", into `name`
+ */
+void starting_hand_name(Card hole, char name[4]) {
+        uint32_t low = __builtin_ctzll(hole);
+        uint32_t high = 63 - __builtin_clzll(hole);
+        char high_rank = RANK_CHARS[high % 16];
+        char low_rank = RANK_CHARS[low % 16];
+        if (low % 16 > high % 16) {
+                high_rank = RANK_CHARS[low % 16];
+                low_rank = RANK_CHARS[high % 16];
+        }
+
+        snprintf(name, 4, "%c%c%s", high_rank, low_rank,
+                 high_rank == low_rank ? "" : low / 16 == high / 16 ? "s" : "o");
+}
+
+/**
+ * Relabels suits so that `hole` becomes the cards its starting hand is solved with, and applies
+ * the same relabelling to `board`
+ */
+Card normalize_suits(Card hole, Card *board) {
+        // starting_hand_cards puts the higher card in hearts and the other in diamonds if offsuit
+        Card first = hole & -hole;
+        Card second = hole ^ first;
+        if (__builtin_ctzll(first) % 16 < __builtin_ctzll(second) % 16) {
+                Card swap = first;
+                first = second;
+                second = swap;
+        }
+
+        uint8_t permutation[4];
+        uint32_t first_suit = __builtin_ctzll(first) / 16;
+        uint32_t second_suit = __builtin_ctzll(second) / 16;
+        bool taken[4] = {false};
+        permutation[first_suit] = 1;
+        taken[1] = true;
+        if (second_suit != first_suit) {
+                permutation[second_suit] = 2;
+                taken[2] = true;
+        }
+
+        uint8_t next = 0;
+        for (uint32_t suit = 0; suit < 4; suit += 1) {
+                if (suit == first_suit || suit == second_suit) {
+                        continue;
+                }
+                while (taken[next]) {
+                        next += 1;
+                }
+                permutation[suit] = next;
+                taken[next] = true;
+        }
+
+        *board = permute_suits(*board, permutation);
+        return permute_suits(hole, permutation);
+}
+
+/**
+ * Prepares `solution` for `hand` and allocates its flop table. Returns false if it can't be
+ * allocated.
+ */
+bool init_solution(struct Solution *solution, Card hand) {
+        memset(solution, 0, sizeof(*solution));
+        solution->hand = hand;
+        solution->deck = FULL_DECK ^ hand;
+        init_suit_symmetry(&solution->symmetry, hand);
+
+        solution->flop_nodes = malloc(NUM_FLOPS * sizeof(struct FlopNode));
+        if (!solution->flop_nodes) {
+                fprintf(stderr, "Could not allocate solver tables\n");
+                return false;
+        }
+        return true;
+}
+
+void free_solution(struct Solution *solution) {
+        if (solution->runout_mapped) {
+                unmap_table_file(solution->runout, sizeof(struct RunoutTable));
+        } else {
+                free((void *)solution->runout);
+        }
+        free(solution->flop_nodes);
+        solution->runout = NULL;
+        solution->flop_nodes = NULL;
+}
+
+/**
+ * Returns the size of a runout table holding the outcomes of its first `chunks` chunks
+ */
+uint64_t runout_table_size(uint32_t chunks) {
+        uint64_t boards = (uint64_t)chunks * RUNOUT_CHUNK_SIZE;
+        return offsetof(struct RunoutTable, board_outcomes) +
+               (boards < NUM_BOARDS ? boards : NUM_BOARDS) * sizeof(struct BoardOutcome);
+}
+
+/**
+ * Maps a runout table, finished or not, saved for `hand`. Returns NULL if there is none, or it
+ * is stale or corrupt.
+ */
+const struct RunoutTable *map_runout_table(const char *path, Card hand) {
+        uint64_t size;
+        const struct RunoutTable *table =
+            map_table_file(path, RUNOUT_TABLE_KIND, EVAL_VERSION, &size);
+        if (!table) {
+                return NULL;
+        }
+
+        if (size < offsetof(struct RunoutTable, board_outcomes) ||
+            table->version != RUNOUT_TABLE_VERSION || table->hand != hand ||
+            table->chunks_done > NUM_RUNOUT_CHUNKS ||
+            size != runout_table_size(table->chunks_done)) {
+                unmap_table_file(table, size);
+                return NULL;
+        }
+        return table;
+}
+
+/**
+ * Maps a finished runout table saved for the solution's hole cards. Returns false if there is
+ * none, or it is unfinished, stale or corrupt.
+ */
+bool load_runout_table(struct Solution *solution, const char *path) {
+        const struct RunoutTable *table = map_runout_table(path, solution->hand);
+        if (!table) {
+                return false;
+        }
+
+        if (table->chunks_done != NUM_RUNOUT_CHUNKS) {
+                unmap_table_file(table, runout_table_size(table->chunks_done));
+                return false;
+        }
+
+        solution->runout = table;
+        solution->runout_mapped = true;
+        return true;
+}
+
+/**
+ * Saves a runout table with the outcomes of its finished chunks to `path`, atomically. Returns
+ * false on any I/O error.
+ */
+bool write_runout_table(const struct RunoutTable *table, const char *path) {
+        return write_table_file(path, RUNOUT_TABLE_KIND, EVAL_VERSION, table,
+                                runout_table_size(table->chunks_done));
+}
+
+/**
+ * Saves the solution's runout table to `path`, atomically. Returns false on any I/O error.
+ */
+bool save_runout_table(const struct Solution *solution, const char *path) {
+        return write_runout_table(solution->runout, path);
+}
+
+struct RunoutJob {
+        struct Solution *solution;
+        struct RunoutTable *table;
+        const struct SolveFiles *files;
+        pthread_t main_thread;
+        uint32_t next_chunk;
+        uint32_t end_chunk;
+        uint32_t chunks_finished;
+        struct Progress progress;
+        double last_checkpoint;
+        // Chunks are finished out of order. Totals are folded into the table header, and
+        // checkpointed, only for the finished prefix.
+        uint8_t chunk_done[NUM_RUNOUT_CHUNKS];
+        int64_t chunk_raise4_totals[NUM_RUNOUT_CHUNKS];
+        int64_t chunk_raise3_totals[NUM_RUNOUT_CHUNKS];
+        uint32_t chunk_counts[NUM_RUNOUT_CHUNKS];
+};
+
+void simulate_runout_chunk(struct RunoutJob *job, uint32_t chunk) {
+        struct Solution *solution = job->solution;
+        const uint64_t hand = solution->hand;
+
+        uint32_t start = chunk * RUNOUT_CHUNK_SIZE;
+        uint32_t end = start + RUNOUT_CHUNK_SIZE < NUM_BOARDS ? start + RUNOUT_CHUNK_SIZE
+                                                               : NUM_BOARDS;
+        struct CombinationIterator boards;
+        combinations_start(&boards, 5, solution->deck, start);
+        int64_t raise4_total = 0;
+        int64_t raise3_total = 0;
+
+        uint32_t count = 0;
+        for (uint32_t i = start; i < end; i += 1, combinations_next(&boards)) {
+                const uint64_t board = boards.cards;
+                struct BoardOutcome outcome = {0, 0};
+
+                // Only the canonical board of each suit-isomorphism class is scored, weighted by
+                // the class size. The others are looked up through their canonical board.
+                uint32_t weight = canonical_weight(&solution->symmetry, board);
+
+                if (weight) {
+                        count += 1;
+                        STATS_ADD(runout_boards, 1);
+
+                        // The board is fixed for all dealer holes, so analyse it once and only
+                        // add each pair of hole cards
+                        struct BoardState state;
+                        board_eval_init(&state, board);
+                        uint32_t player_score = board_eval_finish(&state, hand);
+                        struct DealerCounts counts = kernels->score_dealers(
+                            &state, solution->deck ^ board, player_score);
+
+                        outcome = board_outcome(counts.wins_qualified, counts.wins_unqualified,
+                                                counts.losses, player_score);
+                        raise4_total += weight * outcome_payout(outcome, 4);
+                        raise3_total += weight * outcome_payout(outcome, 3);
+                }
+
+                job->table->board_outcomes[i] = outcome;
+        }
+
+        job->chunk_raise4_totals[chunk] = raise4_total;
+        job->chunk_raise3_totals[chunk] = raise3_total;
+        job->chunk_counts[chunk] = count;
+        __atomic_store_n(&job->chunk_done[chunk], 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Folds the totals of newly finished chunks at the front of the table into its header. Only
+ * called from the main thread, the only one touching the header.
+ */
+void fold_finished_chunks(struct RunoutJob *job) {
+        struct RunoutTable *table = job->table;
+        while (table->chunks_done < NUM_RUNOUT_CHUNKS &&
+               __atomic_load_n(&job->chunk_done[table->chunks_done], __ATOMIC_ACQUIRE)) {
+                table->raise4_total += job->chunk_raise4_totals[table->chunks_done];
+                table->raise3_total += job->chunk_raise3_totals[table->chunks_done];
+                table->canonical_boards += job->chunk_counts[table->chunks_done];
+                table->chunks_done += 1;
+        }
+}
+
+void *runout_worker(void *arg) {
+        struct RunoutJob *job = arg;
+        bool main_thread = pthread_equal(pthread_self(), job->main_thread);
+
+        for (;;) {
+                uint32_t chunk = __atomic_fetch_add(&job->next_chunk, 1, __ATOMIC_RELAXED);
+                if (chunk >= job->end_chunk) {
+                        STATS_MERGE_THREAD();
+                        return NULL;
+                }
+
+                simulate_runout_chunk(job, chunk);
+                uint32_t finished = __atomic_add_fetch(&job->chunks_finished, 1, __ATOMIC_RELAXED);
+                progress_update(&job->progress, finished);
+
+                double now = monotonic_seconds();
+                if (main_thread && job->files->checkpoint && job->files->runout_path &&
+                    now - job->last_checkpoint >= checkpoint_interval) {
+                        fold_finished_chunks(job);
+                        if (!write_runout_table(job->table, job->files->runout_path)) {
+                                fprintf(stderr, "Could not checkpoint %s\n",
+                                        job->files->runout_path);
+                        }
+                        job->last_checkpoint = now;
+                }
+        }
+}
+
+/**
+ * Builds the runout table, scoring every canonical board, and continuing from a checkpoint when
+ * resuming. Only chunks first_chunk to end_chunk are scored, so a shard of the runout can be
+ * built on its own; its table's header then only totals those. Returns false if it can't be
+ * allocated.
+ */
+bool simulate_runout(struct Solution *solution, const struct SolveFiles *files,
+                     uint32_t first_chunk, uint32_t end_chunk) {
+        fprintf(stderr, "Simulating runout\n");
+        STATS_TIMER(runout);
+
+        struct RunoutTable *table = malloc(sizeof(struct RunoutTable));
+        struct RunoutJob *job = calloc(1, sizeof(struct RunoutJob));
+        if (!table || !job) {
+                fprintf(stderr, "Could not allocate solver tables\n");
+                free(table);
+                free(job);
+                return false;
+        }
+        memset(table, 0, offsetof(struct RunoutTable, board_outcomes));
+        table->version = RUNOUT_TABLE_VERSION;
+        table->hand = solution->hand;
+        table->chunks_done = first_chunk;
+
+        const struct RunoutTable *checkpoint = NULL;
+        if (files->resume && files->runout_path && first_chunk == 0) {
+                checkpoint = map_runout_table(files->runout_path, solution->hand);
+        }
+        if (checkpoint) {
+                uint64_t size = runout_table_size(checkpoint->chunks_done);
+                memcpy(table, checkpoint, size);
+                unmap_table_file(checkpoint, size);
+                fprintf(stderr, "Resuming runout at chunk %u/%u\n", table->chunks_done,
+                        NUM_RUNOUT_CHUNKS);
+        }
+
+        job->solution = solution;
+        job->table = table;
+        job->files = files;
+        job->main_thread = pthread_self();
+        job->next_chunk = table->chunks_done;
+        job->end_chunk = end_chunk;
+        job->chunks_finished = table->chunks_done;
+        job->last_checkpoint = monotonic_seconds();
+        memset(job->chunk_done, 1, table->chunks_done);
+        progress_init(&job->progress, "runout chunks", table->chunks_done, end_chunk);
+
+        pthread_t threads[num_threads];
+        uint32_t spawned = 0;
+        while (spawned + 1 < num_threads &&
+               pthread_create(&threads[spawned], NULL, runout_worker, job) == 0) {
+                spawned += 1;
+        }
+        runout_worker(job);
+        for (uint32_t t = 0; t < spawned; t += 1) {
+                pthread_join(threads[t], NULL);
+        }
+
+        fold_finished_chunks(job);
+        progress_finish(&job->progress);
+        free(job);
+
+        solution->runout = table;
+        solution->runout_mapped = false;
+        STATS_TIME(runout_ns, runout);
+        return true;
+}
+
+/**
+ * Solves the flop decision for one flop from the river values of its 1081 turn/river boards
+ */
+void simulate_river(const struct Solution *solution, uint64_t flop, struct FlopNode *node) {
+        STATS_TIMER(river);
+        int64_t bet_total = 0;
+        int64_t check_total = 0;
+        uint32_t river_folds = 0;
+
+        struct CombinationIterator rivers;
+        combinations_start(&rivers, 2, solution->deck ^ flop, 0);
+        for (int i = 0; i < NUM_TURN_RIVERS; i += 1, combinations_next(&rivers)) {
+                uint32_t weight;
+                uint64_t cc = canonical_cards(&solution->symmetry, flop | rivers.cards, &weight);
+                uint64_t index = kernels->combination_index(cc, solution->deck);
+                struct BoardOutcome outcome = solution->runout->board_outcomes[index];
+
+                int64_t river_value;
+                river_folds += river_decision(outcome, &river_value) == ACTION_FOLD;
+                bet_total += outcome_payout(outcome, 2);
+                check_total += river_value;
+        }
+
+        node->bet_total = bet_total;
+        node->check_total = check_total;
+        node->river_folds = river_folds;
+        node->action = bet_total >= check_total ? ACTION_BET_2X : ACTION_CHECK;
+        STATS_ADD(solved_flops, 1);
+        STATS_TIME(river_ns, river);
+}
+
+/**
+ * Returns a runout table total as an EV per unit ante
+ */
+double runout_ev(int64_t total) {
+        return total / ((double)HALF_UNITS * NUM_BOARDS * NUM_DEALER_HOLES);
+}
+
+/**
+ * Returns a flop node total as an EV per unit ante
+ */
+double flop_node_ev(int64_t total) {
+        return total / ((double)HALF_UNITS * NUM_TURN_RIVERS * NUM_DEALER_HOLES);
+}
+
+/**
+ * Saves the flop sweep up to `next_flop` to `path`, atomically. Returns false on any I/O error.
+ */
+bool write_flop_checkpoint(const struct Solution *solution, uint32_t next_flop, int64_t total,
+                           const char *path) {
+        struct FlopCheckpoint *checkpoint = malloc(sizeof(struct FlopCheckpoint));
+        if (!checkpoint) {
+                return false;
+        }
+
+        memset(checkpoint, 0, offsetof(struct FlopCheckpoint, flop_nodes));
+        checkpoint->version = FLOP_CHECKPOINT_VERSION;
+        checkpoint->next_flop = next_flop;
+        checkpoint->hand = solution->hand;
+        checkpoint->check_total = total;
+        memcpy(checkpoint->flop_nodes, solution->flop_nodes, NUM_FLOPS * sizeof(struct FlopNode));
+
+        bool ok = write_table_file(path, FLOP_CHECKPOINT_KIND, EVAL_VERSION, checkpoint,
+                                   sizeof(struct FlopCheckpoint));
+        free(checkpoint);
+        return ok;
+}
+
+/**
+ * Restores a flop sweep checkpoint saved for the solution's hole cards, storing its total in
+ * `total`. Returns the first flop still to solve, or 0 if there is no usable checkpoint.
+ */
+uint32_t read_flop_checkpoint(struct Solution *solution, const char *path, int64_t *total) {
+        uint64_t size;
+        const struct FlopCheckpoint *checkpoint =
+            map_table_file(path, FLOP_CHECKPOINT_KIND, EVAL_VERSION, &size);
+        if (!checkpoint) {
+                return 0;
+        }
+
+        uint32_t next_flop = 0;
+        if (size == sizeof(struct FlopCheckpoint) &&
+            checkpoint->version == FLOP_CHECKPOINT_VERSION && checkpoint->hand == solution->hand &&
+            checkpoint->next_flop <= NUM_FLOPS) {
+                next_flop = checkpoint->next_flop;
+                *total = checkpoint->check_total;
+                memcpy(solution->flop_nodes, checkpoint->flop_nodes,
+                       next_flop * sizeof(struct FlopNode));
+        }
+
+        unmap_table_file(checkpoint, size);
+        return next_flop;
+}
+
+/**
+ * Solves every canonical flop from first_flop to end_flop into flop_nodes, and stores their
+ * total in the solution's check_total. A full sweep checkpoints and resumes as `files` asks.
+ * Requires the solution's runout table.
+ */
+void simulate_flop(struct Solution *solution, const struct SolveFiles *files, uint32_t first_flop,
+                   uint32_t end_flop) {
+        int64_t total = 0;
+        bool full = first_flop == 0 && end_flop == NUM_FLOPS;
+        STATS_TIMER(flop);
+
+        if (full && files->resume && files->flop_path) {
+                first_flop = read_flop_checkpoint(solution, files->flop_path, &total);
+                if (first_flop) {
+                        fprintf(stderr, "Resuming flops at %u/%u\n", first_flop, NUM_FLOPS);
+                }
+        }
+
+        struct Progress progress;
+        progress_init(&progress, "flops", first_flop, end_flop);
+        double last_checkpoint = monotonic_seconds();
+        bool checkpoint = full && files->checkpoint && files->flop_path;
+
+        struct CombinationIterator flops;
+        combinations_start(&flops, 3, solution->deck, first_flop < NUM_FLOPS ? first_flop : 0);
+        for (uint32_t i = first_flop; i < end_flop; i += 1, combinations_next(&flops)) {
+                const uint64_t board = flops.cards;
+                struct FlopNode *node = &solution->flop_nodes[i];
+                node->weight = canonical_weight(&solution->symmetry, board);
+                if (node->weight) {
+                        simulate_river(solution, board, node);
+                        total += node->weight * max_int64(node->bet_total, node->check_total);
+                }
+                progress_update(&progress, i + 1);
+
+                double now = monotonic_seconds();
+                if (checkpoint && now - last_checkpoint >= checkpoint_interval) {
+                        if (!write_flop_checkpoint(solution, i + 1, total, files->flop_path)) {
+                                fprintf(stderr, "Could not checkpoint %s\n", files->flop_path);
+                        }
+                        last_checkpoint = now;
+                }
+        }
+        progress_finish(&progress);
+
+        if (checkpoint && first_flop < NUM_FLOPS &&
+            !write_flop_checkpoint(solution, NUM_FLOPS, total, files->flop_path)) {
+                fprintf(stderr, "Could not checkpoint %s\n", files->flop_path);
+        }
+
+        solution->check_total = total;
+        STATS_TIME(flop_ns, flop);
+}
+
+/**
+ * Sets the solution's EVs and preflop action from the totals of its runout table and flops
+ */
+void finish_solution(struct Solution *solution) {
+        const struct RunoutTable *runout = solution->runout;
+        solution->raise4_ev = runout_ev(runout->raise4_total);
+        solution->raise3_ev = runout_ev(runout->raise3_total);
+        solution->check_ev = flop_node_ev(solution->check_total) / NUM_FLOPS;
+
+        // The raise totals are over boards and the check total over flops, so compare them on the
+        // same scale, which can exceed 64 bits, before choosing
+        __int128 raise4 = (__int128)runout->raise4_total * NUM_FLOPS * NUM_TURN_RIVERS;
+        __int128 raise3 = (__int128)runout->raise3_total * NUM_FLOPS * NUM_TURN_RIVERS;
+        __int128 check = (__int128)solution->check_total * NUM_BOARDS;
+
+        solution->action = ACTION_CHECK;
+        if (raise3 > check) {
+                solution->action = ACTION_RAISE_3X;
+        }
+        if (raise4 >= raise3 && raise4 >= check) {
+                solution->action = ACTION_RAISE_4X;
+        }
+}
+
+/**
+ * Solves the whole decision tree for `hand` into `solution`, which must be released with
+ * free_solution. `files` says where runout tables and checkpoints are kept. Requires
+ * init_engine(ENGINE_HASH). Returns false if the tables can't be allocated.
+ */
+bool solve_hand(Card hand, const struct SolveFiles *files, struct Solution *solution) {
+        if (!init_solution(solution, hand)) {
+                return false;
+        }
+
+        const char *runout_path = files->runout_path;
+        if (runout_path && load_runout_table(solution, runout_path)) {
+                fprintf(stderr, "Loaded runout from %s\n", runout_path);
+        } else if (!simulate_runout(solution, files, 0, NUM_RUNOUT_CHUNKS)) {
+                free_solution(solution);
+                return false;
+        } else if (runout_path && !save_runout_table(solution, runout_path)) {
+                fprintf(stderr, "Could not write %s\n", runout_path);
+        }
+
+        fprintf(stderr, "total (count %d): %f\n", solution->runout->canonical_boards,
+                runout_ev(solution->runout->raise4_total));
+
+        simulate_flop(solution, files, 0, NUM_FLOPS);
+        finish_solution(solution);
+        return true;
+}
+
+/**
+ * Returns the solved flop node for any flop
+ */
+const struct FlopNode *find_flop_node(const struct Solution *solution, Card flop) {
+        uint32_t weight;
+        Card canonical = canonical_cards(&solution->symmetry, flop, &weight);
+        return &solution->flop_nodes[kernels->combination_index(canonical, solution->deck)];
+}
+
+/**
+ * Returns the outcome of any five-card board
+ */
+struct BoardOutcome find_board_outcome(const struct Solution *solution, Card board) {
+        uint32_t weight;
+        Card canonical = canonical_cards(&solution->symmetry, board, &weight);
+        uint64_t index = kernels->combination_index(canonical, solution->deck);
+        return solution->runout->board_outcomes[index];
+}
+
+/**
+ * Returns the best river action for any board, storing its EV per unit ante in `ev`
+ */
+enum Action find_river_action(const struct Solution *solution, Card board, double *ev) {
+        struct BoardOutcome outcome = find_board_outcome(solution, board);
+
+        int64_t value;
+        enum Action action = river_decision(outcome, &value);
+        *ev = value / ((double)HALF_UNITS * NUM_DEALER_HOLES);
+        return action;
+}
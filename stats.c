@@ -0,0 +1,125 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Hot-path counters and phase timers, compiled in with -DUTX_STATS and dumped as JSON on stderr at
+// exit. Without it every STATS_ macro expands to nothing, so the instrumented code is unchanged.
+//
+// Counters are thread-local so the hot loops never share a cache line. Worker threads fold theirs
+// into the totals with stats_merge_thread before they exit; the main thread's are folded in at
+// exit.
+
+enum StatsCategory {
+        STATS_STRAIGHT_FLUSH,
+        STATS_QUADS,
+        STATS_FULL_HOUSE,
+        STATS_FLUSH,
+        STATS_STRAIGHT,
+        STATS_TRIPS,
+        STATS_TWO_PAIR,
+        STATS_PAIR,
+        STATS_HIGH_CARD,
+        NUM_STATS_CATEGORIES
+};
+
+struct Stats {
+        // eval_hand, by the category path that returned
+        uint64_t eval_categories[NUM_STATS_CATEGORIES];
+        // Rank-mask table loads by eval_flush and eval_high_card
+        uint64_t flush_lookups;
+        uint64_t high_card_lookups;
+        // eval_hand_hash and board_eval_finish, and how often the flush table won
+        uint64_t hash_evals;
+        uint64_t board_evals;
+        uint64_t board_eval_flushes;
+        // Combination steps, and candidates next_combination skipped for touching a deadzone
+        uint64_t combinations;
+        uint64_t combination_skips;
+        // Solver work and wall time per phase, in nanoseconds
+        uint64_t runout_boards;
+        uint64_t solved_flops;
+        uint64_t runout_ns;
+        uint64_t flop_ns;
+        uint64_t river_ns;
+};
+
+#ifdef UTX_STATS
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+const char *STATS_CATEGORY_NAMES[NUM_STATS_CATEGORIES] = {
+    "straight_flush", "quads", "full_house", "flush",    "straight",
+    "trips",          "two_pair", "pair",    "high_card"};
+
+struct Stats stats_totals;
+_Thread_local struct Stats thread_stats;
+pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+uint64_t stats_nanoseconds() {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+/**
+ * Adds this thread's counters to the totals and clears them
+ */
+void stats_merge_thread() {
+        uint64_t *from = (uint64_t *)&thread_stats;
+        uint64_t *to = (uint64_t *)&stats_totals;
+
+        pthread_mutex_lock(&stats_mutex);
+        for (size_t i = 0; i < sizeof(struct Stats) / sizeof(uint64_t); i += 1) {
+                to[i] += from[i];
+        }
+        pthread_mutex_unlock(&stats_mutex);
+        memset(&thread_stats, 0, sizeof(thread_stats));
+}
+
+/**
+ * Returns count per second of `ns`, or 0 if no time was spent
+ */
+double stats_rate(uint64_t count, uint64_t ns) { return ns ? count * 1e9 / ns : 0.0; }
+
+void stats_dump() {
+        stats_merge_thread();
+        const struct Stats *s = &stats_totals;
+
+        fprintf(stderr, "{\"eval_categories\": {");
+        for (int i = 0; i < NUM_STATS_CATEGORIES; i += 1) {
+                fprintf(stderr, "%s\"%s\": %lu", i ? ", " : "", STATS_CATEGORY_NAMES[i],
+                        s->eval_categories[i]);
+        }
+        fprintf(stderr,
+                "},\n \"flush_lookups\": %lu, \"high_card_lookups\": %lu,\n"
+                " \"hash_evals\": %lu, \"board_evals\": %lu, \"board_eval_flushes\": %lu,\n"
+                " \"combinations\": %lu, \"combination_skips\": %lu,\n"
+                " \"runout_boards\": %lu, \"solved_flops\": %lu,\n"
+                " \"runout_seconds\": %.6f, \"flop_seconds\": %.6f, \"river_seconds\": %.6f,\n"
+                " \"boards_per_second\": %.1f, \"evals_per_second\": %.1f}\n",
+                s->flush_lookups, s->high_card_lookups, s->hash_evals, s->board_evals,
+                s->board_eval_flushes, s->combinations, s->combination_skips, s->runout_boards,
+                s->solved_flops, s->runout_ns / 1e9, s->flop_ns / 1e9, s->river_ns / 1e9,
+                stats_rate(s->runout_boards, s->runout_ns),
+                stats_rate(s->board_evals + s->hash_evals, s->runout_ns));
+}
+
+__attribute__((constructor)) void stats_register() { atexit(stats_dump); }
+
+#define STATS_ADD(counter, n) (thread_stats.counter += (n))
+#define STATS_TIMER(timer) uint64_t timer##_start = stats_nanoseconds()
+#define STATS_TIME(counter, timer) STATS_ADD(counter, stats_nanoseconds() - timer##_start)
+#define STATS_MERGE_THREAD() stats_merge_thread()
+
+#else
+
+#define STATS_ADD(counter, n) ((void)0)
+#define STATS_TIMER(timer) ((void)0)
+#define STATS_TIME(counter, timer) ((void)0)
+#define STATS_MERGE_THREAD() ((void)0)
+
+#endif
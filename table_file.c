@@ -0,0 +1,157 @@
+#pragma once
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// On-disk tables are a fixed header followed by the raw payload. The header is padded to 64
+// bytes so the payload stays cache-line aligned once mapped.
+#define TABLE_FILE_MAGIC 0x454C424154585455ULL // "UTXTABLE", little-endian
+#define TABLE_FILE_FORMAT_VERSION 1
+#define TABLE_FILE_HEADER_SIZE 64
+#define TABLE_FILE_KIND_LENGTH 16
+
+// Whether map_table_file checksums the payload as well as checking the header. Every payload is
+// checksummed as it is written, and reading all 37 MB of the hash evaluator table back costs more
+// than the rest of startup, so only `verify`, the table generator and UTX_VERIFY_TABLES=1 turn
+// it on.
+bool verify_table_checksums = false;
+
+struct TableFileHeader {
+        uint64_t magic;
+        uint32_t format_version;
+        uint32_t eval_version;
+        char kind[TABLE_FILE_KIND_LENGTH];
+        uint64_t size;
+        uint64_t checksum;
+        uint8_t padding[TABLE_FILE_HEADER_SIZE - 48];
+};
+
+/**
+ * FNV-1a over 64-bit words, with the tail folded in a byte at a time
+ */
+uint64_t table_checksum(const void *data, uint64_t size) {
+        const uint8_t *bytes = data;
+        uint64_t hash = 0xCBF29CE484222325ULL;
+
+        uint64_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+                uint64_t word;
+                memcpy(&word, bytes + i, 8);
+                hash = (hash ^ word) * 0x100000001B3ULL;
+        }
+        for (; i < size; i += 1) {
+                hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+        }
+
+        return hash;
+}
+
+bool write_all(int fd, const void *data, uint64_t size) {
+        const uint8_t *bytes = data;
+        while (size > 0) {
+                ssize_t written = write(fd, bytes, size);
+                if (written < 0 && errno == EINTR) {
+                        continue;
+                }
+                // A regular file only writes nothing once the disk is full
+                if (written <= 0) {
+                        return false;
+                }
+                bytes += written;
+                size -= written;
+        }
+
+        return true;
+}
+
+/**
+ * Writes a table file next to `path` and renames it into place, so readers never see a partial
+ * file. Returns false on any I/O error.
+ */
+bool write_table_file(const char *path, const char *kind, uint32_t eval_version, const void *data,
+                      uint64_t size) {
+        char tmp_path[4096];
+        int length = snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%d", path, getpid());
+        if (length < 0 || (size_t)length >= sizeof(tmp_path)) {
+                return false;
+        }
+
+        struct TableFileHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = TABLE_FILE_MAGIC;
+        header.format_version = TABLE_FILE_FORMAT_VERSION;
+        header.eval_version = eval_version;
+        strncpy(header.kind, kind, TABLE_FILE_KIND_LENGTH - 1);
+        header.size = size;
+        header.checksum = table_checksum(data, size);
+
+        int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+                return false;
+        }
+
+        bool ok = write_all(fd, &header, sizeof(header)) && write_all(fd, data, size) &&
+                  fsync(fd) == 0;
+        ok = close(fd) == 0 && ok;
+
+        if (!ok || rename(tmp_path, path) != 0) {
+                unlink(tmp_path);
+                return false;
+        }
+
+        return true;
+}
+
+/**
+ * Maps a table file read-only and returns a pointer to its payload, or NULL if the file is
+ * missing, has the wrong kind, evaluator version or size, or fails its checksum when
+ * verify_table_checksums is set. On success the payload size is stored in `size`.
+ */
+const void *map_table_file(const char *path, const char *kind, uint32_t eval_version,
+                           uint64_t *size) {
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) {
+                return NULL;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < TABLE_FILE_HEADER_SIZE) {
+                close(fd);
+                return NULL;
+        }
+
+        void *mapping = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+                return NULL;
+        }
+
+        const char *verify = getenv("UTX_VERIFY_TABLES");
+        bool checksum = verify_table_checksums || (verify && strcmp(verify, "1") == 0);
+        const struct TableFileHeader *header = mapping;
+        const uint8_t *payload = (const uint8_t *)mapping + TABLE_FILE_HEADER_SIZE;
+        if (header->magic != TABLE_FILE_MAGIC ||
+            header->format_version != TABLE_FILE_FORMAT_VERSION ||
+            header->eval_version != eval_version ||
+            strncmp(header->kind, kind, TABLE_FILE_KIND_LENGTH) != 0 ||
+            header->size != (uint64_t)st.st_size - TABLE_FILE_HEADER_SIZE ||
+            (checksum && header->checksum != table_checksum(payload, header->size))) {
+                munmap(mapping, st.st_size);
+                return NULL;
+        }
+
+        *size = header->size;
+        return payload;
+}
+
+void unmap_table_file(const void *payload, uint64_t size) {
+        munmap((uint8_t *)payload - TABLE_FILE_HEADER_SIZE, size + TABLE_FILE_HEADER_SIZE);
+}
@@ -0,0 +1,1948 @@
+// Generated by gen_tables.c with `make tables`. Do not edit.
+
+#pragma once
+
+#include <stdint.h>
+
+const uint64_t unique_five_lookup_table[1277] = {
+    47, 55, 59, 61, 79, 87, 91, 93, 94, 103, 107, 109, 110, 115, 117, 118, 121, 122, 143, 151, 155,
+    157, 158, 167, 171, 173, 174, 179, 181, 182, 185, 186, 188, 199, 203, 205, 206, 211, 213, 214,
+    217, 218, 220, 227, 229, 230, 233, 234, 236, 241, 242, 244, 271, 279, 283, 285, 286, 295, 299,
+    301, 302, 307, 309, 310, 313, 314, 316, 327, 331, 333, 334, 339, 341, 342, 345, 346, 348, 355,
+    357, 358, 361, 362, 364, 369, 370, 372, 376, 391, 395, 397, 398, 403, 405, 406, 409, 410, 412,
+    419, 421, 422, 425, 426, 428, 433, 434, 436, 440, 451, 453, 454, 457, 458, 460, 465, 466, 468,
+    472, 481, 482, 484, 488, 527, 535, 539, 541, 542, 551, 555, 557, 558, 563, 565, 566, 569, 570,
+    572, 583, 587, 589, 590, 595, 597, 598, 601, 602, 604, 611, 613, 614, 617, 618, 620, 625, 626,
+    628, 632, 647, 651, 653, 654, 659, 661, 662, 665, 666, 668, 675, 677, 678, 681, 682, 684, 689,
+    690, 692, 696, 707, 709, 710, 713, 714, 716, 721, 722, 724, 728, 737, 738, 740, 744, 752, 775,
+    779, 781, 782, 787, 789, 790, 793, 794, 796, 803, 805, 806, 809, 810, 812, 817, 818, 820, 824,
+    835, 837, 838, 841, 842, 844, 849, 850, 852, 856, 865, 866, 868, 872, 880, 899, 901, 902, 905,
+    906, 908, 913, 914, 916, 920, 929, 930, 932, 936, 944, 961, 962, 964, 968, 976, 1039, 1047,
+    1051, 1053, 1054, 1063, 1067, 1069, 1070, 1075, 1077, 1078, 1081, 1082, 1084, 1095, 1099, 1101,
+    1102, 1107, 1109, 1110, 1113, 1114, 1116, 1123, 1125, 1126, 1129, 1130, 1132, 1137, 1138, 1140,
+    1144, 1159, 1163, 1165, 1166, 1171, 1173, 1174, 1177, 1178, 1180, 1187, 1189, 1190, 1193, 1194,
+    1196, 1201, 1202, 1204, 1208, 1219, 1221, 1222, 1225, 1226, 1228, 1233, 1234, 1236, 1240, 1249,
+    1250, 1252, 1256, 1264, 1287, 1291, 1293, 1294, 1299, 1301, 1302, 1305, 1306, 1308, 1315, 1317,
+    1318, 1321, 1322, 1324, 1329, 1330, 1332, 1336, 1347, 1349, 1350, 1353, 1354, 1356, 1361, 1362,
+    1364, 1368, 1377, 1378, 1380, 1384, 1392, 1411, 1413, 1414, 1417, 1418, 1420, 1425, 1426, 1428,
+    1432, 1441, 1442, 1444, 1448, 1456, 1473, 1474, 1476, 1480, 1488, 1504, 1543, 1547, 1549, 1550,
+    1555, 1557, 1558, 1561, 1562, 1564, 1571, 1573, 1574, 1577, 1578, 1580, 1585, 1586, 1588, 1592,
+    1603, 1605, 1606, 1609, 1610, 1612, 1617, 1618, 1620, 1624, 1633, 1634, 1636, 1640, 1648, 1667,
+    1669, 1670, 1673, 1674, 1676, 1681, 1682, 1684, 1688, 1697, 1698, 1700, 1704, 1712, 1729, 1730,
+    1732, 1736, 1744, 1760, 1795, 1797, 1798, 1801, 1802, 1804, 1809, 1810, 1812, 1816, 1825, 1826,
+    1828, 1832, 1840, 1857, 1858, 1860, 1864, 1872, 1888, 1921, 1922, 1924, 1928, 1936, 1952, 2063,
+    2071, 2075, 2077, 2078, 2087, 2091, 2093, 2094, 2099, 2101, 2102, 2105, 2106, 2108, 2119, 2123,
+    2125, 2126, 2131, 2133, 2134, 2137, 2138, 2140, 2147, 2149, 2150, 2153, 2154, 2156, 2161, 2162,
+    2164, 2168, 2183, 2187, 2189, 2190, 2195, 2197, 2198, 2201, 2202, 2204, 2211, 2213, 2214, 2217,
+    2218, 2220, 2225, 2226, 2228, 2232, 2243, 2245, 2246, 2249, 2250, 2252, 2257, 2258, 2260, 2264,
+    2273, 2274, 2276, 2280, 2288, 2311, 2315, 2317, 2318, 2323, 2325, 2326, 2329, 2330, 2332, 2339,
+    2341, 2342, 2345, 2346, 2348, 2353, 2354, 2356, 2360, 2371, 2373, 2374, 2377, 2378, 2380, 2385,
+    2386, 2388, 2392, 2401, 2402, 2404, 2408, 2416, 2435, 2437, 2438, 2441, 2442, 2444, 2449, 2450,
+    2452, 2456, 2465, 2466, 2468, 2472, 2480, 2497, 2498, 2500, 2504, 2512, 2528, 2567, 2571, 2573,
+    2574, 2579, 2581, 2582, 2585, 2586, 2588, 2595, 2597, 2598, 2601, 2602, 2604, 2609, 2610, 2612,
+    2616, 2627, 2629, 2630, 2633, 2634, 2636, 2641, 2642, 2644, 2648, 2657, 2658, 2660, 2664, 2672,
+    2691, 2693, 2694, 2697, 2698, 2700, 2705, 2706, 2708, 2712, 2721, 2722, 2724, 2728, 2736, 2753,
+    2754, 2756, 2760, 2768, 2784, 2819, 2821, 2822, 2825, 2826, 2828, 2833, 2834, 2836, 2840, 2849,
+    2850, 2852, 2856, 2864, 2881, 2882, 2884, 2888, 2896, 2912, 2945, 2946, 2948, 2952, 2960, 2976,
+    3008, 3079, 3083, 3085, 3086, 3091, 3093, 3094, 3097, 3098, 3100, 3107, 3109, 3110, 3113, 3114,
+    3116, 3121, 3122, 3124, 3128, 3139, 3141, 3142, 3145, 3146, 3148, 3153, 3154, 3156, 3160, 3169,
+    3170, 3172, 3176, 3184, 3203, 3205, 3206, 3209, 3210, 3212, 3217, 3218, 3220, 3224, 3233, 3234,
+    3236, 3240, 3248, 3265, 3266, 3268, 3272, 3280, 3296, 3331, 3333, 3334, 3337, 3338, 3340, 3345,
+    3346, 3348, 3352, 3361, 3362, 3364, 3368, 3376, 3393, 3394, 3396, 3400, 3408, 3424, 3457, 3458,
+    3460, 3464, 3472, 3488, 3520, 3587, 3589, 3590, 3593, 3594, 3596, 3601, 3602, 3604, 3608, 3617,
+    3618, 3620, 3624, 3632, 3649, 3650, 3652, 3656, 3664, 3680, 3713, 3714, 3716, 3720, 3728, 3744,
+    3776, 3841, 3842, 3844, 3848, 3856, 3872, 3904, 4119, 4123, 4125, 4126, 4135, 4139, 4141, 4142,
+    4147, 4149, 4150, 4153, 4154, 4156, 4167, 4171, 4173, 4174, 4179, 4181, 4182, 4185, 4186, 4188,
+    4195, 4197, 4198, 4201, 4202, 4204, 4209, 4210, 4212, 4216, 4231, 4235, 4237, 4238, 4243, 4245,
+    4246, 4249, 4250, 4252, 4259, 4261, 4262, 4265, 4266, 4268, 4273, 4274, 4276, 4280, 4291, 4293,
+    4294, 4297, 4298, 4300, 4305, 4306, 4308, 4312, 4321, 4322, 4324, 4328, 4336, 4359, 4363, 4365,
+    4366, 4371, 4373, 4374, 4377, 4378, 4380, 4387, 4389, 4390, 4393, 4394, 4396, 4401, 4402, 4404,
+    4408, 4419, 4421, 4422, 4425, 4426, 4428, 4433, 4434, 4436, 4440, 4449, 4450, 4452, 4456, 4464,
+    4483, 4485, 4486, 4489, 4490, 4492, 4497, 4498, 4500, 4504, 4513, 4514, 4516, 4520, 4528, 4545,
+    4546, 4548, 4552, 4560, 4576, 4615, 4619, 4621, 4622, 4627, 4629, 4630, 4633, 4634, 4636, 4643,
+    4645, 4646, 4649, 4650, 4652, 4657, 4658, 4660, 4664, 4675, 4677, 4678, 4681, 4682, 4684, 4689,
+    4690, 4692, 4696, 4705, 4706, 4708, 4712, 4720, 4739, 4741, 4742, 4745, 4746, 4748, 4753, 4754,
+    4756, 4760, 4769, 4770, 4772, 4776, 4784, 4801, 4802, 4804, 4808, 4816, 4832, 4867, 4869, 4870,
+    4873, 4874, 4876, 4881, 4882, 4884, 4888, 4897, 4898, 4900, 4904, 4912, 4929, 4930, 4932, 4936,
+    4944, 4960, 4993, 4994, 4996, 5000, 5008, 5024, 5056, 5127, 5131, 5133, 5134, 5139, 5141, 5142,
+    5145, 5146, 5148, 5155, 5157, 5158, 5161, 5162, 5164, 5169, 5170, 5172, 5176, 5187, 5189, 5190,
+    5193, 5194, 5196, 5201, 5202, 5204, 5208, 5217, 5218, 5220, 5224, 5232, 5251, 5253, 5254, 5257,
+    5258, 5260, 5265, 5266, 5268, 5272, 5281, 5282, 5284, 5288, 5296, 5313, 5314, 5316, 5320, 5328,
+    5344, 5379, 5381, 5382, 5385, 5386, 5388, 5393, 5394, 5396, 5400, 5409, 5410, 5412, 5416, 5424,
+    5441, 5442, 5444, 5448, 5456, 5472, 5505, 5506, 5508, 5512, 5520, 5536, 5568, 5635, 5637, 5638,
+    5641, 5642, 5644, 5649, 5650, 5652, 5656, 5665, 5666, 5668, 5672, 5680, 5697, 5698, 5700, 5704,
+    5712, 5728, 5761, 5762, 5764, 5768, 5776, 5792, 5824, 5889, 5890, 5892, 5896, 5904, 5920, 5952,
+    6016, 6151, 6155, 6157, 6158, 6163, 6165, 6166, 6169, 6170, 6172, 6179, 6181, 6182, 6185, 6186,
+    6188, 6193, 6194, 6196, 6200, 6211, 6213, 6214, 6217, 6218, 6220, 6225, 6226, 6228, 6232, 6241,
+    6242, 6244, 6248, 6256, 6275, 6277, 6278, 6281, 6282, 6284, 6289, 6290, 6292, 6296, 6305, 6306,
+    6308, 6312, 6320, 6337, 6338, 6340, 6344, 6352, 6368, 6403, 6405, 6406, 6409, 6410, 6412, 6417,
+    6418, 6420, 6424, 6433, 6434, 6436, 6440, 6448, 6465, 6466, 6468, 6472, 6480, 6496, 6529, 6530,
+    6532, 6536, 6544, 6560, 6592, 6659, 6661, 6662, 6665, 6666, 6668, 6673, 6674, 6676, 6680, 6689,
+    6690, 6692, 6696, 6704, 6721, 6722, 6724, 6728, 6736, 6752, 6785, 6786, 6788, 6792, 6800, 6816,
+    6848, 6913, 6914, 6916, 6920, 6928, 6944, 6976, 7040, 7171, 7173, 7174, 7177, 7178, 7180, 7185,
+    7186, 7188, 7192, 7201, 7202, 7204, 7208, 7216, 7233, 7234, 7236, 7240, 7248, 7264, 7297, 7298,
+    7300, 7304, 7312, 7328, 7360, 7425, 7426, 7428, 7432, 7440, 7456, 7488, 7552, 7681, 7682, 7684,
+    7688, 7696, 7712, 7744, 7808,
+};
+
+const uint16_t top_five_table[8192] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 62, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 94, 96, 97,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 110, 112, 113, 114, 115, 116,
+    117, 118, 118, 120, 121, 122, 122, 124, 124, 124, 124, 128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154,
+    155, 156, 157, 158, 158, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+    174, 174, 176, 177, 178, 179, 180, 181, 182, 182, 184, 185, 186, 186, 188, 188, 188, 188, 192,
+    193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 206, 208, 209, 210, 211,
+    212, 213, 214, 214, 216, 217, 218, 218, 220, 220, 220, 220, 224, 225, 226, 227, 228, 229, 230,
+    230, 232, 233, 234, 234, 236, 236, 236, 236, 240, 241, 242, 242, 244, 244, 244, 244, 248, 248,
+    248, 248, 248, 248, 248, 248, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+    269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 286,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 302, 304, 305, 306,
+    307, 308, 309, 310, 310, 312, 313, 314, 314, 316, 316, 316, 316, 320, 321, 322, 323, 324, 325,
+    326, 327, 328, 329, 330, 331, 332, 333, 334, 334, 336, 337, 338, 339, 340, 341, 342, 342, 344,
+    345, 346, 346, 348, 348, 348, 348, 352, 353, 354, 355, 356, 357, 358, 358, 360, 361, 362, 362,
+    364, 364, 364, 364, 368, 369, 370, 370, 372, 372, 372, 372, 376, 376, 376, 376, 376, 376, 376,
+    376, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 398, 400, 401,
+    402, 403, 404, 405, 406, 406, 408, 409, 410, 410, 412, 412, 412, 412, 416, 417, 418, 419, 420,
+    421, 422, 422, 424, 425, 426, 426, 428, 428, 428, 428, 432, 433, 434, 434, 436, 436, 436, 436,
+    440, 440, 440, 440, 440, 440, 440, 440, 448, 449, 450, 451, 452, 453, 454, 454, 456, 457, 458,
+    458, 460, 460, 460, 460, 464, 465, 466, 466, 468, 468, 468, 468, 472, 472, 472, 472, 472, 472,
+    472, 472, 480, 481, 482, 482, 484, 484, 484, 484, 488, 488, 488, 488, 488, 488, 488, 488, 496,
+    496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 512, 513, 514, 515,
+    516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+    535, 536, 537, 538, 539, 540, 541, 542, 542, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553,
+    554, 555, 556, 557, 558, 558, 560, 561, 562, 563, 564, 565, 566, 566, 568, 569, 570, 570, 572,
+    572, 572, 572, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 590,
+    592, 593, 594, 595, 596, 597, 598, 598, 600, 601, 602, 602, 604, 604, 604, 604, 608, 609, 610,
+    611, 612, 613, 614, 614, 616, 617, 618, 618, 620, 620, 620, 620, 624, 625, 626, 626, 628, 628,
+    628, 628, 632, 632, 632, 632, 632, 632, 632, 632, 640, 641, 642, 643, 644, 645, 646, 647, 648,
+    649, 650, 651, 652, 653, 654, 654, 656, 657, 658, 659, 660, 661, 662, 662, 664, 665, 666, 666,
+    668, 668, 668, 668, 672, 673, 674, 675, 676, 677, 678, 678, 680, 681, 682, 682, 684, 684, 684,
+    684, 688, 689, 690, 690, 692, 692, 692, 692, 696, 696, 696, 696, 696, 696, 696, 696, 704, 705,
+    706, 707, 708, 709, 710, 710, 712, 713, 714, 714, 716, 716, 716, 716, 720, 721, 722, 722, 724,
+    724, 724, 724, 728, 728, 728, 728, 728, 728, 728, 728, 736, 737, 738, 738, 740, 740, 740, 740,
+    744, 744, 744, 744, 744, 744, 744, 744, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752,
+    752, 752, 752, 752, 752, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781,
+    782, 782, 784, 785, 786, 787, 788, 789, 790, 790, 792, 793, 794, 794, 796, 796, 796, 796, 800,
+    801, 802, 803, 804, 805, 806, 806, 808, 809, 810, 810, 812, 812, 812, 812, 816, 817, 818, 818,
+    820, 820, 820, 820, 824, 824, 824, 824, 824, 824, 824, 824, 832, 833, 834, 835, 836, 837, 838,
+    838, 840, 841, 842, 842, 844, 844, 844, 844, 848, 849, 850, 850, 852, 852, 852, 852, 856, 856,
+    856, 856, 856, 856, 856, 856, 864, 865, 866, 866, 868, 868, 868, 868, 872, 872, 872, 872, 872,
+    872, 872, 872, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880,
+    896, 897, 898, 899, 900, 901, 902, 902, 904, 905, 906, 906, 908, 908, 908, 908, 912, 913, 914,
+    914, 916, 916, 916, 916, 920, 920, 920, 920, 920, 920, 920, 920, 928, 929, 930, 930, 932, 932,
+    932, 932, 936, 936, 936, 936, 936, 936, 936, 936, 944, 944, 944, 944, 944, 944, 944, 944, 944,
+    944, 944, 944, 944, 944, 944, 944, 960, 961, 962, 962, 964, 964, 964, 964, 968, 968, 968, 968,
+    968, 968, 968, 968, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976, 976,
+    976, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992,
+    992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 1024, 1025, 1026, 1027,
+    1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043,
+    1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1054, 1056, 1057, 1058, 1059,
+    1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1070, 1072, 1073, 1074, 1075,
+    1076, 1077, 1078, 1078, 1080, 1081, 1082, 1082, 1084, 1084, 1084, 1084, 1088, 1089, 1090, 1091,
+    1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1102, 1104, 1105, 1106, 1107,
+    1108, 1109, 1110, 1110, 1112, 1113, 1114, 1114, 1116, 1116, 1116, 1116, 1120, 1121, 1122, 1123,
+    1124, 1125, 1126, 1126, 1128, 1129, 1130, 1130, 1132, 1132, 1132, 1132, 1136, 1137, 1138, 1138,
+    1140, 1140, 1140, 1140, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1152, 1153, 1154, 1155,
+    1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1166, 1168, 1169, 1170, 1171,
+    1172, 1173, 1174, 1174, 1176, 1177, 1178, 1178, 1180, 1180, 1180, 1180, 1184, 1185, 1186, 1187,
+    1188, 1189, 1190, 1190, 1192, 1193, 1194, 1194, 1196, 1196, 1196, 1196, 1200, 1201, 1202, 1202,
+    1204, 1204, 1204, 1204, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1216, 1217, 1218, 1219,
+    1220, 1221, 1222, 1222, 1224, 1225, 1226, 1226, 1228, 1228, 1228, 1228, 1232, 1233, 1234, 1234,
+    1236, 1236, 1236, 1236, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1248, 1249, 1250, 1250,
+    1252, 1252, 1252, 1252, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1264, 1264, 1264, 1264,
+    1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1280, 1281, 1282, 1283,
+    1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1294, 1296, 1297, 1298, 1299,
+    1300, 1301, 1302, 1302, 1304, 1305, 1306, 1306, 1308, 1308, 1308, 1308, 1312, 1313, 1314, 1315,
+    1316, 1317, 1318, 1318, 1320, 1321, 1322, 1322, 1324, 1324, 1324, 1324, 1328, 1329, 1330, 1330,
+    1332, 1332, 1332, 1332, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1344, 1345, 1346, 1347,
+    1348, 1349, 1350, 1350, 1352, 1353, 1354, 1354, 1356, 1356, 1356, 1356, 1360, 1361, 1362, 1362,
+    1364, 1364, 1364, 1364, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1376, 1377, 1378, 1378,
+    1380, 1380, 1380, 1380, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1392, 1392, 1392, 1392,
+    1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1408, 1409, 1410, 1411,
+    1412, 1413, 1414, 1414, 1416, 1417, 1418, 1418, 1420, 1420, 1420, 1420, 1424, 1425, 1426, 1426,
+    1428, 1428, 1428, 1428, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1440, 1441, 1442, 1442,
+    1444, 1444, 1444, 1444, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1456, 1456, 1456, 1456,
+    1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1472, 1473, 1474, 1474,
+    1476, 1476, 1476, 1476, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1488, 1488, 1488, 1488,
+    1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1504, 1504, 1504, 1504,
+    1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+    1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1536, 1537, 1538, 1539,
+    1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1550, 1552, 1553, 1554, 1555,
+    1556, 1557, 1558, 1558, 1560, 1561, 1562, 1562, 1564, 1564, 1564, 1564, 1568, 1569, 1570, 1571,
+    1572, 1573, 1574, 1574, 1576, 1577, 1578, 1578, 1580, 1580, 1580, 1580, 1584, 1585, 1586, 1586,
+    1588, 1588, 1588, 1588, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1600, 1601, 1602, 1603,
+    1604, 1605, 1606, 1606, 1608, 1609, 1610, 1610, 1612, 1612, 1612, 1612, 1616, 1617, 1618, 1618,
+    1620, 1620, 1620, 1620, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1632, 1633, 1634, 1634,
+    1636, 1636, 1636, 1636, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1648, 1648, 1648, 1648,
+    1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1664, 1665, 1666, 1667,
+    1668, 1669, 1670, 1670, 1672, 1673, 1674, 1674, 1676, 1676, 1676, 1676, 1680, 1681, 1682, 1682,
+    1684, 1684, 1684, 1684, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1696, 1697, 1698, 1698,
+    1700, 1700, 1700, 1700, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1712, 1712, 1712, 1712,
+    1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1728, 1729, 1730, 1730,
+    1732, 1732, 1732, 1732, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1744, 1744, 1744, 1744,
+    1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1760, 1760, 1760, 1760,
+    1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760,
+    1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1792, 1793, 1794, 1795,
+    1796, 1797, 1798, 1798, 1800, 1801, 1802, 1802, 1804, 1804, 1804, 1804, 1808, 1809, 1810, 1810,
+    1812, 1812, 1812, 1812, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1824, 1825, 1826, 1826,
+    1828, 1828, 1828, 1828, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1840, 1840, 1840, 1840,
+    1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1856, 1857, 1858, 1858,
+    1860, 1860, 1860, 1860, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1864, 1872, 1872, 1872, 1872,
+    1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1888, 1888, 1888, 1888,
+    1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
+    1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1920, 1921, 1922, 1922,
+    1924, 1924, 1924, 1924, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1936, 1936, 1936, 1936,
+    1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1952, 1952, 1952, 1952,
+    1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952,
+    1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1984, 1984, 1984, 1984,
+    1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984,
+    1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984,
+    1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984,
+    1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 2048, 2049, 2050, 2051,
+    2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067,
+    2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2078, 2080, 2081, 2082, 2083,
+    2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2094, 2096, 2097, 2098, 2099,
+    2100, 2101, 2102, 2102, 2104, 2105, 2106, 2106, 2108, 2108, 2108, 2108, 2112, 2113, 2114, 2115,
+    2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2126, 2128, 2129, 2130, 2131,
+    2132, 2133, 2134, 2134, 2136, 2137, 2138, 2138, 2140, 2140, 2140, 2140, 2144, 2145, 2146, 2147,
+    2148, 2149, 2150, 2150, 2152, 2153, 2154, 2154, 2156, 2156, 2156, 2156, 2160, 2161, 2162, 2162,
+    2164, 2164, 2164, 2164, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2176, 2177, 2178, 2179,
+    2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2190, 2192, 2193, 2194, 2195,
+    2196, 2197, 2198, 2198, 2200, 2201, 2202, 2202, 2204, 2204, 2204, 2204, 2208, 2209, 2210, 2211,
+    2212, 2213, 2214, 2214, 2216, 2217, 2218, 2218, 2220, 2220, 2220, 2220, 2224, 2225, 2226, 2226,
+    2228, 2228, 2228, 2228, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2240, 2241, 2242, 2243,
+    2244, 2245, 2246, 2246, 2248, 2249, 2250, 2250, 2252, 2252, 2252, 2252, 2256, 2257, 2258, 2258,
+    2260, 2260, 2260, 2260, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2264, 2272, 2273, 2274, 2274,
+    2276, 2276, 2276, 2276, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2288, 2288, 2288, 2288,
+    2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2304, 2305, 2306, 2307,
+    2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2318, 2320, 2321, 2322, 2323,
+    2324, 2325, 2326, 2326, 2328, 2329, 2330, 2330, 2332, 2332, 2332, 2332, 2336, 2337, 2338, 2339,
+    2340, 2341, 2342, 2342, 2344, 2345, 2346, 2346, 2348, 2348, 2348, 2348, 2352, 2353, 2354, 2354,
+    2356, 2356, 2356, 2356, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2368, 2369, 2370, 2371,
+    2372, 2373, 2374, 2374, 2376, 2377, 2378, 2378, 2380, 2380, 2380, 2380, 2384, 2385, 2386, 2386,
+    2388, 2388, 2388, 2388, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2392, 2400, 2401, 2402, 2402,
+    2404, 2404, 2404, 2404, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2416, 2416, 2416, 2416,
+    2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2432, 2433, 2434, 2435,
+    2436, 2437, 2438, 2438, 2440, 2441, 2442, 2442, 2444, 2444, 2444, 2444, 2448, 2449, 2450, 2450,
+    2452, 2452, 2452, 2452, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2464, 2465, 2466, 2466,
+    2468, 2468, 2468, 2468, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2480, 2480, 2480, 2480,
+    2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2496, 2497, 2498, 2498,
+    2500, 2500, 2500, 2500, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2512, 2512, 2512, 2512,
+    2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2528, 2528, 2528, 2528,
+    2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
+    2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2560, 2561, 2562, 2563,
+    2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2574, 2576, 2577, 2578, 2579,
+    2580, 2581, 2582, 2582, 2584, 2585, 2586, 2586, 2588, 2588, 2588, 2588, 2592, 2593, 2594, 2595,
+    2596, 2597, 2598, 2598, 2600, 2601, 2602, 2602, 2604, 2604, 2604, 2604, 2608, 2609, 2610, 2610,
+    2612, 2612, 2612, 2612, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2624, 2625, 2626, 2627,
+    2628, 2629, 2630, 2630, 2632, 2633, 2634, 2634, 2636, 2636, 2636, 2636, 2640, 2641, 2642, 2642,
+    2644, 2644, 2644, 2644, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2656, 2657, 2658, 2658,
+    2660, 2660, 2660, 2660, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2672, 2672, 2672, 2672,
+    2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2688, 2689, 2690, 2691,
+    2692, 2693, 2694, 2694, 2696, 2697, 2698, 2698, 2700, 2700, 2700, 2700, 2704, 2705, 2706, 2706,
+    2708, 2708, 2708, 2708, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2720, 2721, 2722, 2722,
+    2724, 2724, 2724, 2724, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2736, 2736, 2736, 2736,
+    2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2752, 2753, 2754, 2754,
+    2756, 2756, 2756, 2756, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2768, 2768, 2768, 2768,
+    2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2784, 2784, 2784, 2784,
+    2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784,
+    2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2816, 2817, 2818, 2819,
+    2820, 2821, 2822, 2822, 2824, 2825, 2826, 2826, 2828, 2828, 2828, 2828, 2832, 2833, 2834, 2834,
+    2836, 2836, 2836, 2836, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2848, 2849, 2850, 2850,
+    2852, 2852, 2852, 2852, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2864, 2864, 2864, 2864,
+    2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2880, 2881, 2882, 2882,
+    2884, 2884, 2884, 2884, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2896, 2896, 2896, 2896,
+    2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2912, 2912, 2912, 2912,
+    2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912,
+    2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2944, 2945, 2946, 2946,
+    2948, 2948, 2948, 2948, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2960, 2960, 2960, 2960,
+    2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2976, 2976, 2976, 2976,
+    2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976,
+    2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 3008, 3008, 3008, 3008,
+    3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
+    3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
+    3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
+    3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3072, 3073, 3074, 3075,
+    3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3086, 3088, 3089, 3090, 3091,
+    3092, 3093, 3094, 3094, 3096, 3097, 3098, 3098, 3100, 3100, 3100, 3100, 3104, 3105, 3106, 3107,
+    3108, 3109, 3110, 3110, 3112, 3113, 3114, 3114, 3116, 3116, 3116, 3116, 3120, 3121, 3122, 3122,
+    3124, 3124, 3124, 3124, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3136, 3137, 3138, 3139,
+    3140, 3141, 3142, 3142, 3144, 3145, 3146, 3146, 3148, 3148, 3148, 3148, 3152, 3153, 3154, 3154,
+    3156, 3156, 3156, 3156, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3168, 3169, 3170, 3170,
+    3172, 3172, 3172, 3172, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3184, 3184, 3184, 3184,
+    3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3200, 3201, 3202, 3203,
+    3204, 3205, 3206, 3206, 3208, 3209, 3210, 3210, 3212, 3212, 3212, 3212, 3216, 3217, 3218, 3218,
+    3220, 3220, 3220, 3220, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3232, 3233, 3234, 3234,
+    3236, 3236, 3236, 3236, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3248, 3248, 3248, 3248,
+    3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3264, 3265, 3266, 3266,
+    3268, 3268, 3268, 3268, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3272, 3280, 3280, 3280, 3280,
+    3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3296, 3296, 3296, 3296,
+    3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296,
+    3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3328, 3329, 3330, 3331,
+    3332, 3333, 3334, 3334, 3336, 3337, 3338, 3338, 3340, 3340, 3340, 3340, 3344, 3345, 3346, 3346,
+    3348, 3348, 3348, 3348, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3360, 3361, 3362, 3362,
+    3364, 3364, 3364, 3364, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3376, 3376, 3376, 3376,
+    3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3392, 3393, 3394, 3394,
+    3396, 3396, 3396, 3396, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3408, 3408, 3408, 3408,
+    3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3424, 3424, 3424, 3424,
+    3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424,
+    3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3456, 3457, 3458, 3458,
+    3460, 3460, 3460, 3460, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3472, 3472, 3472, 3472,
+    3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3488, 3488, 3488, 3488,
+    3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488,
+    3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3520, 3520, 3520, 3520,
+    3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520,
+    3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520,
+    3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520,
+    3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3584, 3585, 3586, 3587,
+    3588, 3589, 3590, 3590, 3592, 3593, 3594, 3594, 3596, 3596, 3596, 3596, 3600, 3601, 3602, 3602,
+    3604, 3604, 3604, 3604, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3616, 3617, 3618, 3618,
+    3620, 3620, 3620, 3620, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3624, 3632, 3632, 3632, 3632,
+    3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3648, 3649, 3650, 3650,
+    3652, 3652, 3652, 3652, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3664, 3664, 3664, 3664,
+    3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3680, 3680, 3680, 3680,
+    3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680,
+    3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3712, 3713, 3714, 3714,
+    3716, 3716, 3716, 3716, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3728, 3728, 3728, 3728,
+    3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3744, 3744, 3744, 3744,
+    3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744,
+    3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3776, 3776, 3776, 3776,
+    3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776,
+    3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776,
+    3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776,
+    3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3840, 3841, 3842, 3842,
+    3844, 3844, 3844, 3844, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3848, 3856, 3856, 3856, 3856,
+    3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3872, 3872, 3872, 3872,
+    3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872,
+    3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3904, 3904, 3904, 3904,
+    3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904,
+    3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904,
+    3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904,
+    3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3968, 3968, 3968, 3968,
+    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
+    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 4096, 4097, 4098, 4099,
+    4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115,
+    4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4126, 4128, 4129, 4130, 4131,
+    4132, 4133, 4134, 4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4142, 4144, 4145, 4146, 4147,
+    4148, 4149, 4150, 4150, 4152, 4153, 4154, 4154, 4156, 4156, 4156, 4156, 4160, 4161, 4162, 4163,
+    4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171, 4172, 4173, 4174, 4174, 4176, 4177, 4178, 4179,
+    4180, 4181, 4182, 4182, 4184, 4185, 4186, 4186, 4188, 4188, 4188, 4188, 4192, 4193, 4194, 4195,
+    4196, 4197, 4198, 4198, 4200, 4201, 4202, 4202, 4204, 4204, 4204, 4204, 4208, 4209, 4210, 4210,
+    4212, 4212, 4212, 4212, 4216, 4216, 4216, 4216, 4216, 4216, 4216, 4216, 4224, 4225, 4226, 4227,
+    4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235, 4236, 4237, 4238, 4238, 4240, 4241, 4242, 4243,
+    4244, 4245, 4246, 4246, 4248, 4249, 4250, 4250, 4252, 4252, 4252, 4252, 4256, 4257, 4258, 4259,
+    4260, 4261, 4262, 4262, 4264, 4265, 4266, 4266, 4268, 4268, 4268, 4268, 4272, 4273, 4274, 4274,
+    4276, 4276, 4276, 4276, 4280, 4280, 4280, 4280, 4280, 4280, 4280, 4280, 4288, 4289, 4290, 4291,
+    4292, 4293, 4294, 4294, 4296, 4297, 4298, 4298, 4300, 4300, 4300, 4300, 4304, 4305, 4306, 4306,
+    4308, 4308, 4308, 4308, 4312, 4312, 4312, 4312, 4312, 4312, 4312, 4312, 4320, 4321, 4322, 4322,
+    4324, 4324, 4324, 4324, 4328, 4328, 4328, 4328, 4328, 4328, 4328, 4328, 4336, 4336, 4336, 4336,
+    4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4352, 4353, 4354, 4355,
+    4356, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366, 4366, 4368, 4369, 4370, 4371,
+    4372, 4373, 4374, 4374, 4376, 4377, 4378, 4378, 4380, 4380, 4380, 4380, 4384, 4385, 4386, 4387,
+    4388, 4389, 4390, 4390, 4392, 4393, 4394, 4394, 4396, 4396, 4396, 4396, 4400, 4401, 4402, 4402,
+    4404, 4404, 4404, 4404, 4408, 4408, 4408, 4408, 4408, 4408, 4408, 4408, 4416, 4417, 4418, 4419,
+    4420, 4421, 4422, 4422, 4424, 4425, 4426, 4426, 4428, 4428, 4428, 4428, 4432, 4433, 4434, 4434,
+    4436, 4436, 4436, 4436, 4440, 4440, 4440, 4440, 4440, 4440, 4440, 4440, 4448, 4449, 4450, 4450,
+    4452, 4452, 4452, 4452, 4456, 4456, 4456, 4456, 4456, 4456, 4456, 4456, 4464, 4464, 4464, 4464,
+    4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4480, 4481, 4482, 4483,
+    4484, 4485, 4486, 4486, 4488, 4489, 4490, 4490, 4492, 4492, 4492, 4492, 4496, 4497, 4498, 4498,
+    4500, 4500, 4500, 4500, 4504, 4504, 4504, 4504, 4504, 4504, 4504, 4504, 4512, 4513, 4514, 4514,
+    4516, 4516, 4516, 4516, 4520, 4520, 4520, 4520, 4520, 4520, 4520, 4520, 4528, 4528, 4528, 4528,
+    4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4544, 4545, 4546, 4546,
+    4548, 4548, 4548, 4548, 4552, 4552, 4552, 4552, 4552, 4552, 4552, 4552, 4560, 4560, 4560, 4560,
+    4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4576, 4576, 4576, 4576,
+    4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576,
+    4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4608, 4609, 4610, 4611,
+    4612, 4613, 4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4622, 4624, 4625, 4626, 4627,
+    4628, 4629, 4630, 4630, 4632, 4633, 4634, 4634, 4636, 4636, 4636, 4636, 4640, 4641, 4642, 4643,
+    4644, 4645, 4646, 4646, 4648, 4649, 4650, 4650, 4652, 4652, 4652, 4652, 4656, 4657, 4658, 4658,
+    4660, 4660, 4660, 4660, 4664, 4664, 4664, 4664, 4664, 4664, 4664, 4664, 4672, 4673, 4674, 4675,
+    4676, 4677, 4678, 4678, 4680, 4681, 4682, 4682, 4684, 4684, 4684, 4684, 4688, 4689, 4690, 4690,
+    4692, 4692, 4692, 4692, 4696, 4696, 4696, 4696, 4696, 4696, 4696, 4696, 4704, 4705, 4706, 4706,
+    4708, 4708, 4708, 4708, 4712, 4712, 4712, 4712, 4712, 4712, 4712, 4712, 4720, 4720, 4720, 4720,
+    4720, 4720, 4720, 4720, 4720, 4720, 4720, 4720, 4720, 4720, 4720, 4720, 4736, 4737, 4738, 4739,
+    4740, 4741, 4742, 4742, 4744, 4745, 4746, 4746, 4748, 4748, 4748, 4748, 4752, 4753, 4754, 4754,
+    4756, 4756, 4756, 4756, 4760, 4760, 4760, 4760, 4760, 4760, 4760, 4760, 4768, 4769, 4770, 4770,
+    4772, 4772, 4772, 4772, 4776, 4776, 4776, 4776, 4776, 4776, 4776, 4776, 4784, 4784, 4784, 4784,
+    4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4800, 4801, 4802, 4802,
+    4804, 4804, 4804, 4804, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4816, 4816, 4816, 4816,
+    4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4832, 4832, 4832, 4832,
+    4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
+    4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4864, 4865, 4866, 4867,
+    4868, 4869, 4870, 4870, 4872, 4873, 4874, 4874, 4876, 4876, 4876, 4876, 4880, 4881, 4882, 4882,
+    4884, 4884, 4884, 4884, 4888, 4888, 4888, 4888, 4888, 4888, 4888, 4888, 4896, 4897, 4898, 4898,
+    4900, 4900, 4900, 4900, 4904, 4904, 4904, 4904, 4904, 4904, 4904, 4904, 4912, 4912, 4912, 4912,
+    4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4928, 4929, 4930, 4930,
+    4932, 4932, 4932, 4932, 4936, 4936, 4936, 4936, 4936, 4936, 4936, 4936, 4944, 4944, 4944, 4944,
+    4944, 4944, 4944, 4944, 4944, 4944, 4944, 4944, 4944, 4944, 4944, 4944, 4960, 4960, 4960, 4960,
+    4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960,
+    4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4992, 4993, 4994, 4994,
+    4996, 4996, 4996, 4996, 5000, 5000, 5000, 5000, 5000, 5000, 5000, 5000, 5008, 5008, 5008, 5008,
+    5008, 5008, 5008, 5008, 5008, 5008, 5008, 5008, 5008, 5008, 5008, 5008, 5024, 5024, 5024, 5024,
+    5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024,
+    5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5056, 5056, 5056, 5056,
+    5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056,
+    5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056,
+    5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056,
+    5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5120, 5121, 5122, 5123,
+    5124, 5125, 5126, 5127, 5128, 5129, 5130, 5131, 5132, 5133, 5134, 5134, 5136, 5137, 5138, 5139,
+    5140, 5141, 5142, 5142, 5144, 5145, 5146, 5146, 5148, 5148, 5148, 5148, 5152, 5153, 5154, 5155,
+    5156, 5157, 5158, 5158, 5160, 5161, 5162, 5162, 5164, 5164, 5164, 5164, 5168, 5169, 5170, 5170,
+    5172, 5172, 5172, 5172, 5176, 5176, 5176, 5176, 5176, 5176, 5176, 5176, 5184, 5185, 5186, 5187,
+    5188, 5189, 5190, 5190, 5192, 5193, 5194, 5194, 5196, 5196, 5196, 5196, 5200, 5201, 5202, 5202,
+    5204, 5204, 5204, 5204, 5208, 5208, 5208, 5208, 5208, 5208, 5208, 5208, 5216, 5217, 5218, 5218,
+    5220, 5220, 5220, 5220, 5224, 5224, 5224, 5224, 5224, 5224, 5224, 5224, 5232, 5232, 5232, 5232,
+    5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5248, 5249, 5250, 5251,
+    5252, 5253, 5254, 5254, 5256, 5257, 5258, 5258, 5260, 5260, 5260, 5260, 5264, 5265, 5266, 5266,
+    5268, 5268, 5268, 5268, 5272, 5272, 5272, 5272, 5272, 5272, 5272, 5272, 5280, 5281, 5282, 5282,
+    5284, 5284, 5284, 5284, 5288, 5288, 5288, 5288, 5288, 5288, 5288, 5288, 5296, 5296, 5296, 5296,
+    5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5312, 5313, 5314, 5314,
+    5316, 5316, 5316, 5316, 5320, 5320, 5320, 5320, 5320, 5320, 5320, 5320, 5328, 5328, 5328, 5328,
+    5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5344, 5344, 5344, 5344,
+    5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344,
+    5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5376, 5377, 5378, 5379,
+    5380, 5381, 5382, 5382, 5384, 5385, 5386, 5386, 5388, 5388, 5388, 5388, 5392, 5393, 5394, 5394,
+    5396, 5396, 5396, 5396, 5400, 5400, 5400, 5400, 5400, 5400, 5400, 5400, 5408, 5409, 5410, 5410,
+    5412, 5412, 5412, 5412, 5416, 5416, 5416, 5416, 5416, 5416, 5416, 5416, 5424, 5424, 5424, 5424,
+    5424, 5424, 5424, 5424, 5424, 5424, 5424, 5424, 5424, 5424, 5424, 5424, 5440, 5441, 5442, 5442,
+    5444, 5444, 5444, 5444, 5448, 5448, 5448, 5448, 5448, 5448, 5448, 5448, 5456, 5456, 5456, 5456,
+    5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5472, 5472, 5472, 5472,
+    5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472,
+    5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5504, 5505, 5506, 5506,
+    5508, 5508, 5508, 5508, 5512, 5512, 5512, 5512, 5512, 5512, 5512, 5512, 5520, 5520, 5520, 5520,
+    5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5536, 5536, 5536, 5536,
+    5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536,
+    5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5568, 5568, 5568, 5568,
+    5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568,
+    5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568,
+    5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568,
+    5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5632, 5633, 5634, 5635,
+    5636, 5637, 5638, 5638, 5640, 5641, 5642, 5642, 5644, 5644, 5644, 5644, 5648, 5649, 5650, 5650,
+    5652, 5652, 5652, 5652, 5656, 5656, 5656, 5656, 5656, 5656, 5656, 5656, 5664, 5665, 5666, 5666,
+    5668, 5668, 5668, 5668, 5672, 5672, 5672, 5672, 5672, 5672, 5672, 5672, 5680, 5680, 5680, 5680,
+    5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5696, 5697, 5698, 5698,
+    5700, 5700, 5700, 5700, 5704, 5704, 5704, 5704, 5704, 5704, 5704, 5704, 5712, 5712, 5712, 5712,
+    5712, 5712, 5712, 5712, 5712, 5712, 5712, 5712, 5712, 5712, 5712, 5712, 5728, 5728, 5728, 5728,
+    5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728,
+    5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5760, 5761, 5762, 5762,
+    5764, 5764, 5764, 5764, 5768, 5768, 5768, 5768, 5768, 5768, 5768, 5768, 5776, 5776, 5776, 5776,
+    5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5792, 5792, 5792, 5792,
+    5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792,
+    5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5824, 5824, 5824, 5824,
+    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824,
+    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824,
+    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824,
+    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5888, 5889, 5890, 5890,
+    5892, 5892, 5892, 5892, 5896, 5896, 5896, 5896, 5896, 5896, 5896, 5896, 5904, 5904, 5904, 5904,
+    5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5920, 5920, 5920, 5920,
+    5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920,
+    5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5952, 5952, 5952, 5952,
+    5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952,
+    5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952,
+    5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952,
+    5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 6016, 6016, 6016, 6016,
+    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
+    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
+    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
+    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
+    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
+    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
+    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
+    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6144, 6145, 6146, 6147,
+    6148, 6149, 6150, 6151, 6152, 6153, 6154, 6155, 6156, 6157, 6158, 6158, 6160, 6161, 6162, 6163,
+    6164, 6165, 6166, 6166, 6168, 6169, 6170, 6170, 6172, 6172, 6172, 6172, 6176, 6177, 6178, 6179,
+    6180, 6181, 6182, 6182, 6184, 6185, 6186, 6186, 6188, 6188, 6188, 6188, 6192, 6193, 6194, 6194,
+    6196, 6196, 6196, 6196, 6200, 6200, 6200, 6200, 6200, 6200, 6200, 6200, 6208, 6209, 6210, 6211,
+    6212, 6213, 6214, 6214, 6216, 6217, 6218, 6218, 6220, 6220, 6220, 6220, 6224, 6225, 6226, 6226,
+    6228, 6228, 6228, 6228, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6240, 6241, 6242, 6242,
+    6244, 6244, 6244, 6244, 6248, 6248, 6248, 6248, 6248, 6248, 6248, 6248, 6256, 6256, 6256, 6256,
+    6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6272, 6273, 6274, 6275,
+    6276, 6277, 6278, 6278, 6280, 6281, 6282, 6282, 6284, 6284, 6284, 6284, 6288, 6289, 6290, 6290,
+    6292, 6292, 6292, 6292, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6304, 6305, 6306, 6306,
+    6308, 6308, 6308, 6308, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6312, 6320, 6320, 6320, 6320,
+    6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6336, 6337, 6338, 6338,
+    6340, 6340, 6340, 6340, 6344, 6344, 6344, 6344, 6344, 6344, 6344, 6344, 6352, 6352, 6352, 6352,
+    6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6368, 6368, 6368, 6368,
+    6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368,
+    6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6400, 6401, 6402, 6403,
+    6404, 6405, 6406, 6406, 6408, 6409, 6410, 6410, 6412, 6412, 6412, 6412, 6416, 6417, 6418, 6418,
+    6420, 6420, 6420, 6420, 6424, 6424, 6424, 6424, 6424, 6424, 6424, 6424, 6432, 6433, 6434, 6434,
+    6436, 6436, 6436, 6436, 6440, 6440, 6440, 6440, 6440, 6440, 6440, 6440, 6448, 6448, 6448, 6448,
+    6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6464, 6465, 6466, 6466,
+    6468, 6468, 6468, 6468, 6472, 6472, 6472, 6472, 6472, 6472, 6472, 6472, 6480, 6480, 6480, 6480,
+    6480, 6480, 6480, 6480, 6480, 6480, 6480, 6480, 6480, 6480, 6480, 6480, 6496, 6496, 6496, 6496,
+    6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496,
+    6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6528, 6529, 6530, 6530,
+    6532, 6532, 6532, 6532, 6536, 6536, 6536, 6536, 6536, 6536, 6536, 6536, 6544, 6544, 6544, 6544,
+    6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6560, 6560, 6560, 6560,
+    6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560,
+    6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6592, 6592, 6592, 6592,
+    6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592,
+    6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592,
+    6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592,
+    6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6656, 6657, 6658, 6659,
+    6660, 6661, 6662, 6662, 6664, 6665, 6666, 6666, 6668, 6668, 6668, 6668, 6672, 6673, 6674, 6674,
+    6676, 6676, 6676, 6676, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6688, 6689, 6690, 6690,
+    6692, 6692, 6692, 6692, 6696, 6696, 6696, 6696, 6696, 6696, 6696, 6696, 6704, 6704, 6704, 6704,
+    6704, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6720, 6721, 6722, 6722,
+    6724, 6724, 6724, 6724, 6728, 6728, 6728, 6728, 6728, 6728, 6728, 6728, 6736, 6736, 6736, 6736,
+    6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6752, 6752, 6752, 6752,
+    6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752,
+    6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6784, 6785, 6786, 6786,
+    6788, 6788, 6788, 6788, 6792, 6792, 6792, 6792, 6792, 6792, 6792, 6792, 6800, 6800, 6800, 6800,
+    6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6816, 6816, 6816, 6816,
+    6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816,
+    6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6848, 6848, 6848, 6848,
+    6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848,
+    6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848,
+    6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848,
+    6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6912, 6913, 6914, 6914,
+    6916, 6916, 6916, 6916, 6920, 6920, 6920, 6920, 6920, 6920, 6920, 6920, 6928, 6928, 6928, 6928,
+    6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6944, 6944, 6944, 6944,
+    6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944,
+    6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6976, 6976, 6976, 6976,
+    6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976,
+    6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976,
+    6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976,
+    6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 7040, 7040, 7040, 7040,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7168, 7169, 7170, 7171,
+    7172, 7173, 7174, 7174, 7176, 7177, 7178, 7178, 7180, 7180, 7180, 7180, 7184, 7185, 7186, 7186,
+    7188, 7188, 7188, 7188, 7192, 7192, 7192, 7192, 7192, 7192, 7192, 7192, 7200, 7201, 7202, 7202,
+    7204, 7204, 7204, 7204, 7208, 7208, 7208, 7208, 7208, 7208, 7208, 7208, 7216, 7216, 7216, 7216,
+    7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7232, 7233, 7234, 7234,
+    7236, 7236, 7236, 7236, 7240, 7240, 7240, 7240, 7240, 7240, 7240, 7240, 7248, 7248, 7248, 7248,
+    7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7264, 7264, 7264, 7264,
+    7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+    7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7296, 7297, 7298, 7298,
+    7300, 7300, 7300, 7300, 7304, 7304, 7304, 7304, 7304, 7304, 7304, 7304, 7312, 7312, 7312, 7312,
+    7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7328, 7328, 7328, 7328,
+    7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328,
+    7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7360, 7360, 7360, 7360,
+    7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360,
+    7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360,
+    7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360,
+    7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7424, 7425, 7426, 7426,
+    7428, 7428, 7428, 7428, 7432, 7432, 7432, 7432, 7432, 7432, 7432, 7432, 7440, 7440, 7440, 7440,
+    7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7456, 7456, 7456, 7456,
+    7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456,
+    7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7488, 7488, 7488, 7488,
+    7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+    7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+    7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
+    7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7552, 7552, 7552, 7552,
+    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
+    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
+    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
+    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
+    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
+    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
+    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
+    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7680, 7681, 7682, 7682,
+    7684, 7684, 7684, 7684, 7688, 7688, 7688, 7688, 7688, 7688, 7688, 7688, 7696, 7696, 7696, 7696,
+    7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7712, 7712, 7712, 7712,
+    7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712,
+    7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7744, 7744, 7744, 7744,
+    7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744,
+    7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744,
+    7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744,
+    7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7808, 7808, 7808, 7808,
+    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
+    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
+    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
+    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
+    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
+    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
+    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
+    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
+};
+
+const uint16_t flush_rank_table[8192] = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1598, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1597, 65535, 65535, 65535, 1596, 65535, 1595, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1594, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1593, 65535, 65535, 65535, 1592, 65535, 1591, 1590,
+    1590, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1589, 65535, 65535, 65535, 1588, 65535,
+    1587, 1586, 1586, 65535, 65535, 65535, 1585, 65535, 1584, 1583, 1583, 65535, 1582, 1581, 1581,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1580, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    1579, 65535, 65535, 65535, 1578, 65535, 1577, 1576, 1576, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1575, 65535, 65535, 65535, 1574, 65535, 1573, 1572, 1572, 65535, 65535, 65535,
+    1571, 65535, 1570, 1569, 1569, 65535, 1568, 1567, 1567, 1566, 1566, 1566, 1566, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 1565, 65535, 65535, 65535, 1564, 65535, 1563, 1562, 1562,
+    65535, 65535, 65535, 1561, 65535, 1560, 1559, 1559, 65535, 1558, 1557, 1557, 1556, 1556, 1556,
+    1556, 65535, 65535, 65535, 1555, 65535, 1554, 1553, 1553, 65535, 1552, 1551, 1551, 1550, 1550,
+    1550, 1550, 65535, 1549, 1548, 1548, 1547, 1547, 1547, 1547, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 1546, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1545,
+    65535, 65535, 65535, 1544, 65535, 1543, 1542, 1542, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 1541, 65535, 65535, 65535, 1540, 65535, 1539, 1538, 1538, 65535, 65535, 65535, 1537,
+    65535, 1536, 1535, 1535, 65535, 1534, 1533, 1533, 1532, 1532, 1532, 1532, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1531, 65535, 65535, 65535, 1530, 65535, 1529, 1528, 1528, 65535,
+    65535, 65535, 1527, 65535, 1526, 1525, 1525, 65535, 1524, 1523, 1523, 1522, 1522, 1522, 1522,
+    65535, 65535, 65535, 1521, 65535, 1520, 1519, 1519, 65535, 1518, 1517, 1517, 1516, 1516, 1516,
+    1516, 65535, 1515, 1514, 1514, 1513, 1513, 1513, 1513, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
+    1512, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1511, 65535, 65535, 65535, 1510, 65535,
+    1509, 1508, 1508, 65535, 65535, 65535, 1507, 65535, 1506, 1505, 1505, 65535, 1504, 1503, 1503,
+    1502, 1502, 1502, 1502, 65535, 65535, 65535, 1501, 65535, 1500, 1499, 1499, 65535, 1498, 1497,
+    1497, 1496, 1496, 1496, 1496, 65535, 1495, 1494, 1494, 1493, 1493, 1493, 1493, 1492, 1492, 1492,
+    1492, 1492, 1492, 1492, 1492, 65535, 65535, 65535, 1491, 65535, 1490, 1489, 1489, 65535, 1488,
+    1487, 1487, 1486, 1486, 1486, 1486, 65535, 1485, 1484, 1484, 1483, 1483, 1483, 1483, 1482, 1482,
+    1482, 1482, 1482, 1482, 1482, 1482, 65535, 1481, 1480, 1480, 1479, 1479, 1479, 1479, 1478, 1478,
+    1478, 1478, 1478, 1478, 1478, 1478, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1477, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1476, 65535, 65535, 65535, 1475, 65535, 1474, 1473, 1473, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1472, 65535, 65535, 65535, 1471, 65535, 1470, 1469,
+    1469, 65535, 65535, 65535, 1468, 65535, 1467, 1466, 1466, 65535, 1465, 1464, 1464, 1463, 1463,
+    1463, 1463, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1462, 65535, 65535, 65535, 1461,
+    65535, 1460, 1459, 1459, 65535, 65535, 65535, 1458, 65535, 1457, 1456, 1456, 65535, 1455, 1454,
+    1454, 1453, 1453, 1453, 1453, 65535, 65535, 65535, 1452, 65535, 1451, 1450, 1450, 65535, 1449,
+    1448, 1448, 1447, 1447, 1447, 1447, 65535, 1446, 1445, 1445, 1444, 1444, 1444, 1444, 1443, 1443,
+    1443, 1443, 1443, 1443, 1443, 1443, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1442,
+    65535, 65535, 65535, 1441, 65535, 1440, 1439, 1439, 65535, 65535, 65535, 1438, 65535, 1437,
+    1436, 1436, 65535, 1435, 1434, 1434, 1433, 1433, 1433, 1433, 65535, 65535, 65535, 1432, 65535,
+    1431, 1430, 1430, 65535, 1429, 1428, 1428, 1427, 1427, 1427, 1427, 65535, 1426, 1425, 1425,
+    1424, 1424, 1424, 1424, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 65535, 65535, 65535,
+    1422, 65535, 1421, 1420, 1420, 65535, 1419, 1418, 1418, 1417, 1417, 1417, 1417, 65535, 1416,
+    1415, 1415, 1414, 1414, 1414, 1414, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 65535, 1412,
+    1411, 1411, 1410, 1410, 1410, 1410, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1408, 1408,
+    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1407, 65535, 65535, 65535, 1406, 65535, 1405, 1404,
+    1404, 65535, 65535, 65535, 1403, 65535, 1402, 1401, 1401, 65535, 1400, 1399, 1399, 1398, 1398,
+    1398, 1398, 65535, 65535, 65535, 1397, 65535, 1396, 1395, 1395, 65535, 1394, 1393, 1393, 1392,
+    1392, 1392, 1392, 65535, 1391, 1390, 1390, 1389, 1389, 1389, 1389, 1388, 1388, 1388, 1388, 1388,
+    1388, 1388, 1388, 65535, 65535, 65535, 1387, 65535, 1386, 1385, 1385, 65535, 1384, 1383, 1383,
+    1382, 1382, 1382, 1382, 65535, 1381, 1380, 1380, 1379, 1379, 1379, 1379, 1378, 1378, 1378, 1378,
+    1378, 1378, 1378, 1378, 65535, 1377, 1376, 1376, 1375, 1375, 1375, 1375, 1374, 1374, 1374, 1374,
+    1374, 1374, 1374, 1374, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+    1373, 1373, 1373, 1373, 65535, 65535, 65535, 1372, 65535, 1371, 1370, 1370, 65535, 1369, 1368,
+    1368, 1367, 1367, 1367, 1367, 65535, 1366, 1365, 1365, 1364, 1364, 1364, 1364, 1363, 1363, 1363,
+    1363, 1363, 1363, 1363, 1363, 65535, 1362, 1361, 1361, 1360, 1360, 1360, 1360, 1359, 1359, 1359,
+    1359, 1359, 1359, 1359, 1359, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358,
+    1358, 1358, 1358, 1358, 1358, 65535, 1357, 1356, 1356, 1355, 1355, 1355, 1355, 1354, 1354, 1354,
+    1354, 1354, 1354, 1354, 1354, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353,
+    1353, 1353, 1353, 1353, 1353, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1352, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1351, 65535, 65535, 65535, 1350, 65535, 1349, 1348,
+    1348, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1347, 65535, 65535, 65535, 1346, 65535,
+    1345, 1344, 1344, 65535, 65535, 65535, 1343, 65535, 1342, 1341, 1341, 65535, 1340, 1339, 1339,
+    1338, 1338, 1338, 1338, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1337, 65535, 65535,
+    65535, 1336, 65535, 1335, 1334, 1334, 65535, 65535, 65535, 1333, 65535, 1332, 1331, 1331, 65535,
+    1330, 1329, 1329, 1328, 1328, 1328, 1328, 65535, 65535, 65535, 1327, 65535, 1326, 1325, 1325,
+    65535, 1324, 1323, 1323, 1322, 1322, 1322, 1322, 65535, 1321, 1320, 1320, 1319, 1319, 1319,
+    1319, 1318, 1318, 1318, 1318, 1318, 1318, 1318, 1318, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 1317, 65535, 65535, 65535, 1316, 65535, 1315, 1314, 1314, 65535, 65535, 65535, 1313,
+    65535, 1312, 1311, 1311, 65535, 1310, 1309, 1309, 1308, 1308, 1308, 1308, 65535, 65535, 65535,
+    1307, 65535, 1306, 1305, 1305, 65535, 1304, 1303, 1303, 1302, 1302, 1302, 1302, 65535, 1301,
+    1300, 1300, 1299, 1299, 1299, 1299, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 65535,
+    65535, 65535, 1297, 65535, 1296, 1295, 1295, 65535, 1294, 1293, 1293, 1292, 1292, 1292, 1292,
+    65535, 1291, 1290, 1290, 1289, 1289, 1289, 1289, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+    65535, 1287, 1286, 1286, 1285, 1285, 1285, 1285, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+    1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 1282, 65535, 65535, 65535, 1281, 65535, 1280,
+    1279, 1279, 65535, 65535, 65535, 1278, 65535, 1277, 1276, 1276, 65535, 1275, 1274, 1274, 1273,
+    1273, 1273, 1273, 65535, 65535, 65535, 1272, 65535, 1271, 1270, 1270, 65535, 1269, 1268, 1268,
+    1267, 1267, 1267, 1267, 65535, 1266, 1265, 1265, 1264, 1264, 1264, 1264, 1263, 1263, 1263, 1263,
+    1263, 1263, 1263, 1263, 65535, 65535, 65535, 1262, 65535, 1261, 1260, 1260, 65535, 1259, 1258,
+    1258, 1257, 1257, 1257, 1257, 65535, 1256, 1255, 1255, 1254, 1254, 1254, 1254, 1253, 1253, 1253,
+    1253, 1253, 1253, 1253, 1253, 65535, 1252, 1251, 1251, 1250, 1250, 1250, 1250, 1249, 1249, 1249,
+    1249, 1249, 1249, 1249, 1249, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+    1248, 1248, 1248, 1248, 1248, 65535, 65535, 65535, 1247, 65535, 1246, 1245, 1245, 65535, 1244,
+    1243, 1243, 1242, 1242, 1242, 1242, 65535, 1241, 1240, 1240, 1239, 1239, 1239, 1239, 1238, 1238,
+    1238, 1238, 1238, 1238, 1238, 1238, 65535, 1237, 1236, 1236, 1235, 1235, 1235, 1235, 1234, 1234,
+    1234, 1234, 1234, 1234, 1234, 1234, 1233, 1233, 1233, 1233, 1233, 1233, 1233, 1233, 1233, 1233,
+    1233, 1233, 1233, 1233, 1233, 1233, 65535, 1232, 1231, 1231, 1230, 1230, 1230, 1230, 1229, 1229,
+    1229, 1229, 1229, 1229, 1229, 1229, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+    1228, 1228, 1228, 1228, 1228, 1228, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+    1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+    1227, 1227, 1227, 1227, 1227, 1227, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1226,
+    65535, 65535, 65535, 1225, 65535, 1224, 1223, 1223, 65535, 65535, 65535, 1222, 65535, 1221,
+    1220, 1220, 65535, 1219, 1218, 1218, 1217, 1217, 1217, 1217, 65535, 65535, 65535, 1216, 65535,
+    1215, 1214, 1214, 65535, 1213, 1212, 1212, 1211, 1211, 1211, 1211, 65535, 1210, 1209, 1209,
+    1208, 1208, 1208, 1208, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 65535, 65535, 65535,
+    1206, 65535, 1205, 1204, 1204, 65535, 1203, 1202, 1202, 1201, 1201, 1201, 1201, 65535, 1200,
+    1199, 1199, 1198, 1198, 1198, 1198, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 65535, 1196,
+    1195, 1195, 1194, 1194, 1194, 1194, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1192, 1192,
+    1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 65535,
+    65535, 65535, 1191, 65535, 1190, 1189, 1189, 65535, 1188, 1187, 1187, 1186, 1186, 1186, 1186,
+    65535, 1185, 1184, 1184, 1183, 1183, 1183, 1183, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+    65535, 1181, 1180, 1180, 1179, 1179, 1179, 1179, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+    1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177,
+    65535, 1176, 1175, 1175, 1174, 1174, 1174, 1174, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173,
+    1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172,
+    1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171,
+    1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171,
+    65535, 65535, 65535, 1170, 65535, 1169, 1168, 1168, 65535, 1167, 1166, 1166, 1165, 1165, 1165,
+    1165, 65535, 1164, 1163, 1163, 1162, 1162, 1162, 1162, 1161, 1161, 1161, 1161, 1161, 1161, 1161,
+    1161, 65535, 1160, 1159, 1159, 1158, 1158, 1158, 1158, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+    1157, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+    1156, 65535, 1155, 1154, 1154, 1153, 1153, 1153, 1153, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+    1152, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151,
+    1151, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+    1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+    1150, 65535, 1149, 1148, 1148, 1147, 1147, 1147, 1147, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+    1146, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+    1145, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+    1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+    1144, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 1143, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1142, 65535, 65535, 65535, 1141,
+    65535, 1140, 1139, 1139, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1138, 65535, 65535,
+    65535, 1137, 65535, 1136, 1135, 1135, 65535, 65535, 65535, 1134, 65535, 1133, 1132, 1132, 65535,
+    1131, 1130, 1130, 1129, 1129, 1129, 1129, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1128,
+    65535, 65535, 65535, 1127, 65535, 1126, 1125, 1125, 65535, 65535, 65535, 1124, 65535, 1123,
+    1122, 1122, 65535, 1121, 1120, 1120, 1119, 1119, 1119, 1119, 65535, 65535, 65535, 1118, 65535,
+    1117, 1116, 1116, 65535, 1115, 1114, 1114, 1113, 1113, 1113, 1113, 65535, 1112, 1111, 1111,
+    1110, 1110, 1110, 1110, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1108, 65535, 65535, 65535, 1107, 65535, 1106, 1105, 1105, 65535,
+    65535, 65535, 1104, 65535, 1103, 1102, 1102, 65535, 1101, 1100, 1100, 1099, 1099, 1099, 1099,
+    65535, 65535, 65535, 1098, 65535, 1097, 1096, 1096, 65535, 1095, 1094, 1094, 1093, 1093, 1093,
+    1093, 65535, 1092, 1091, 1091, 1090, 1090, 1090, 1090, 1089, 1089, 1089, 1089, 1089, 1089, 1089,
+    1089, 65535, 65535, 65535, 1088, 65535, 1087, 1086, 1086, 65535, 1085, 1084, 1084, 1083, 1083,
+    1083, 1083, 65535, 1082, 1081, 1081, 1080, 1080, 1080, 1080, 1079, 1079, 1079, 1079, 1079, 1079,
+    1079, 1079, 65535, 1078, 1077, 1077, 1076, 1076, 1076, 1076, 1075, 1075, 1075, 1075, 1075, 1075,
+    1075, 1075, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074,
+    1074, 1074, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1073, 65535, 65535, 65535, 1072,
+    65535, 1071, 1070, 1070, 65535, 65535, 65535, 1069, 65535, 1068, 1067, 1067, 65535, 1066, 1065,
+    1065, 1064, 1064, 1064, 1064, 65535, 65535, 65535, 1063, 65535, 1062, 1061, 1061, 65535, 1060,
+    1059, 1059, 1058, 1058, 1058, 1058, 65535, 1057, 1056, 1056, 1055, 1055, 1055, 1055, 1054, 1054,
+    1054, 1054, 1054, 1054, 1054, 1054, 65535, 65535, 65535, 1053, 65535, 1052, 1051, 1051, 65535,
+    1050, 1049, 1049, 1048, 1048, 1048, 1048, 65535, 1047, 1046, 1046, 1045, 1045, 1045, 1045, 1044,
+    1044, 1044, 1044, 1044, 1044, 1044, 1044, 65535, 1043, 1042, 1042, 1041, 1041, 1041, 1041, 1040,
+    1040, 1040, 1040, 1040, 1040, 1040, 1040, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+    1039, 1039, 1039, 1039, 1039, 1039, 1039, 65535, 65535, 65535, 1038, 65535, 1037, 1036, 1036,
+    65535, 1035, 1034, 1034, 1033, 1033, 1033, 1033, 65535, 1032, 1031, 1031, 1030, 1030, 1030,
+    1030, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 65535, 1028, 1027, 1027, 1026, 1026, 1026,
+    1026, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+    1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 65535, 1023, 1022, 1022, 1021, 1021, 1021,
+    1021, 1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020, 1019, 1019, 1019, 1019, 1019, 1019, 1019,
+    1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+    1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+    1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 1017, 65535, 65535, 65535, 1016, 65535, 1015, 1014, 1014, 65535, 65535, 65535, 1013,
+    65535, 1012, 1011, 1011, 65535, 1010, 1009, 1009, 1008, 1008, 1008, 1008, 65535, 65535, 65535,
+    1007, 65535, 1006, 1005, 1005, 65535, 1004, 1003, 1003, 1002, 1002, 1002, 1002, 65535, 1001,
+    1000, 1000, 999, 999, 999, 999, 998, 998, 998, 998, 998, 998, 998, 998, 65535, 65535, 65535,
+    997, 65535, 996, 995, 995, 65535, 994, 993, 993, 992, 992, 992, 992, 65535, 991, 990, 990, 989,
+    989, 989, 989, 988, 988, 988, 988, 988, 988, 988, 988, 65535, 987, 986, 986, 985, 985, 985, 985,
+    984, 984, 984, 984, 984, 984, 984, 984, 983, 983, 983, 983, 983, 983, 983, 983, 983, 983, 983,
+    983, 983, 983, 983, 983, 65535, 65535, 65535, 982, 65535, 981, 980, 980, 65535, 979, 978, 978,
+    977, 977, 977, 977, 65535, 976, 975, 975, 974, 974, 974, 974, 973, 973, 973, 973, 973, 973, 973,
+    973, 65535, 972, 971, 971, 970, 970, 970, 970, 969, 969, 969, 969, 969, 969, 969, 969, 968, 968,
+    968, 968, 968, 968, 968, 968, 968, 968, 968, 968, 968, 968, 968, 968, 65535, 967, 966, 966, 965,
+    965, 965, 965, 964, 964, 964, 964, 964, 964, 964, 964, 963, 963, 963, 963, 963, 963, 963, 963,
+    963, 963, 963, 963, 963, 963, 963, 963, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962,
+    962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962, 962,
+    962, 962, 65535, 65535, 65535, 961, 65535, 960, 959, 959, 65535, 958, 957, 957, 956, 956, 956,
+    956, 65535, 955, 954, 954, 953, 953, 953, 953, 952, 952, 952, 952, 952, 952, 952, 952, 65535,
+    951, 950, 950, 949, 949, 949, 949, 948, 948, 948, 948, 948, 948, 948, 948, 947, 947, 947, 947,
+    947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 947, 65535, 946, 945, 945, 944, 944, 944,
+    944, 943, 943, 943, 943, 943, 943, 943, 943, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942,
+    942, 942, 942, 942, 942, 942, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941,
+    941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941, 941,
+    65535, 940, 939, 939, 938, 938, 938, 938, 937, 937, 937, 937, 937, 937, 937, 937, 936, 936, 936,
+    936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 935, 935, 935, 935, 935, 935,
+    935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 935,
+    935, 935, 935, 935, 935, 935, 935, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934,
+    934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934,
+    934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934,
+    934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 934, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 933, 65535, 65535, 65535, 932, 65535, 931, 930, 930, 65535, 65535,
+    65535, 929, 65535, 928, 927, 927, 65535, 926, 925, 925, 924, 924, 924, 924, 65535, 65535, 65535,
+    923, 65535, 922, 921, 921, 65535, 920, 919, 919, 918, 918, 918, 918, 65535, 917, 916, 916, 915,
+    915, 915, 915, 914, 914, 914, 914, 914, 914, 914, 914, 65535, 65535, 65535, 913, 65535, 912,
+    911, 911, 65535, 910, 909, 909, 908, 908, 908, 908, 65535, 907, 906, 906, 905, 905, 905, 905,
+    904, 904, 904, 904, 904, 904, 904, 904, 65535, 903, 902, 902, 901, 901, 901, 901, 900, 900, 900,
+    900, 900, 900, 900, 900, 899, 899, 899, 899, 899, 899, 899, 899, 899, 899, 899, 899, 899, 899,
+    899, 899, 65535, 65535, 65535, 898, 65535, 897, 896, 896, 65535, 895, 894, 894, 893, 893, 893,
+    893, 65535, 892, 891, 891, 890, 890, 890, 890, 889, 889, 889, 889, 889, 889, 889, 889, 65535,
+    888, 887, 887, 886, 886, 886, 886, 885, 885, 885, 885, 885, 885, 885, 885, 884, 884, 884, 884,
+    884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 65535, 883, 882, 882, 881, 881, 881,
+    881, 880, 880, 880, 880, 880, 880, 880, 880, 879, 879, 879, 879, 879, 879, 879, 879, 879, 879,
+    879, 879, 879, 879, 879, 879, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878,
+    878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878, 878,
+    65535, 65535, 65535, 877, 65535, 876, 875, 875, 65535, 874, 873, 873, 872, 872, 872, 872, 65535,
+    871, 870, 870, 869, 869, 869, 869, 868, 868, 868, 868, 868, 868, 868, 868, 65535, 867, 866, 866,
+    865, 865, 865, 865, 864, 864, 864, 864, 864, 864, 864, 864, 863, 863, 863, 863, 863, 863, 863,
+    863, 863, 863, 863, 863, 863, 863, 863, 863, 65535, 862, 861, 861, 860, 860, 860, 860, 859, 859,
+    859, 859, 859, 859, 859, 859, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858,
+    858, 858, 858, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857,
+    857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 65535, 856, 855,
+    855, 854, 854, 854, 854, 853, 853, 853, 853, 853, 853, 853, 853, 852, 852, 852, 852, 852, 852,
+    852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+    851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+    851, 851, 851, 851, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 65535, 65535, 65535, 849, 65535, 848,
+    847, 847, 65535, 846, 845, 845, 844, 844, 844, 844, 65535, 843, 842, 842, 841, 841, 841, 841,
+    840, 840, 840, 840, 840, 840, 840, 840, 65535, 839, 838, 838, 837, 837, 837, 837, 836, 836, 836,
+    836, 836, 836, 836, 836, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835,
+    835, 835, 65535, 834, 833, 833, 832, 832, 832, 832, 831, 831, 831, 831, 831, 831, 831, 831, 830,
+    830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 829, 829, 829, 829,
+    829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 829,
+    829, 829, 829, 829, 829, 829, 829, 829, 829, 65535, 828, 827, 827, 826, 826, 826, 826, 825, 825,
+    825, 825, 825, 825, 825, 825, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824,
+    824, 824, 824, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823,
+    823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 822, 822, 822,
+    822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822,
+    822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822,
+    822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822,
+    822, 822, 822, 822, 65535, 821, 820, 820, 819, 819, 819, 819, 818, 818, 818, 818, 818, 818, 818,
+    818, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 816, 816,
+    816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816,
+    816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 816, 815, 815, 815, 815, 815, 815, 815, 815,
+    815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+    815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+    815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 814, 65535, 65535, 65535, 813, 65535, 812, 811,
+    811, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 810, 65535, 65535, 65535, 809, 65535, 808,
+    807, 807, 65535, 65535, 65535, 806, 65535, 805, 804, 804, 65535, 803, 802, 802, 801, 801, 801,
+    801, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 800, 65535, 65535, 65535, 799, 65535, 798,
+    797, 797, 65535, 65535, 65535, 796, 65535, 795, 794, 794, 65535, 793, 792, 792, 791, 791, 791,
+    791, 65535, 65535, 65535, 790, 65535, 789, 788, 788, 65535, 787, 786, 786, 785, 785, 785, 785,
+    65535, 784, 783, 783, 782, 782, 782, 782, 781, 781, 781, 781, 781, 781, 781, 781, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 780, 65535, 65535, 65535, 779, 65535, 778, 777, 777, 65535,
+    65535, 65535, 776, 65535, 775, 774, 774, 65535, 773, 772, 772, 771, 771, 771, 771, 65535, 65535,
+    65535, 770, 65535, 769, 768, 768, 65535, 767, 766, 766, 765, 765, 765, 765, 65535, 764, 763,
+    763, 762, 762, 762, 762, 761, 761, 761, 761, 761, 761, 761, 761, 65535, 65535, 65535, 760,
+    65535, 759, 758, 758, 65535, 757, 756, 756, 755, 755, 755, 755, 65535, 754, 753, 753, 752, 752,
+    752, 752, 751, 751, 751, 751, 751, 751, 751, 751, 65535, 750, 749, 749, 748, 748, 748, 748, 747,
+    747, 747, 747, 747, 747, 747, 747, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746,
+    746, 746, 746, 746, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 745, 65535, 65535, 65535,
+    744, 65535, 743, 742, 742, 65535, 65535, 65535, 741, 65535, 740, 739, 739, 65535, 738, 737, 737,
+    736, 736, 736, 736, 65535, 65535, 65535, 735, 65535, 734, 733, 733, 65535, 732, 731, 731, 730,
+    730, 730, 730, 65535, 729, 728, 728, 727, 727, 727, 727, 726, 726, 726, 726, 726, 726, 726, 726,
+    65535, 65535, 65535, 725, 65535, 724, 723, 723, 65535, 722, 721, 721, 720, 720, 720, 720, 65535,
+    719, 718, 718, 717, 717, 717, 717, 716, 716, 716, 716, 716, 716, 716, 716, 65535, 715, 714, 714,
+    713, 713, 713, 713, 712, 712, 712, 712, 712, 712, 712, 712, 711, 711, 711, 711, 711, 711, 711,
+    711, 711, 711, 711, 711, 711, 711, 711, 711, 65535, 65535, 65535, 710, 65535, 709, 708, 708,
+    65535, 707, 706, 706, 705, 705, 705, 705, 65535, 704, 703, 703, 702, 702, 702, 702, 701, 701,
+    701, 701, 701, 701, 701, 701, 65535, 700, 699, 699, 698, 698, 698, 698, 697, 697, 697, 697, 697,
+    697, 697, 697, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696,
+    65535, 695, 694, 694, 693, 693, 693, 693, 692, 692, 692, 692, 692, 692, 692, 692, 691, 691, 691,
+    691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 690, 690, 690, 690, 690, 690,
+    690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690,
+    690, 690, 690, 690, 690, 690, 690, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 689, 65535,
+    65535, 65535, 688, 65535, 687, 686, 686, 65535, 65535, 65535, 685, 65535, 684, 683, 683, 65535,
+    682, 681, 681, 680, 680, 680, 680, 65535, 65535, 65535, 679, 65535, 678, 677, 677, 65535, 676,
+    675, 675, 674, 674, 674, 674, 65535, 673, 672, 672, 671, 671, 671, 671, 670, 670, 670, 670, 670,
+    670, 670, 670, 65535, 65535, 65535, 669, 65535, 668, 667, 667, 65535, 666, 665, 665, 664, 664,
+    664, 664, 65535, 663, 662, 662, 661, 661, 661, 661, 660, 660, 660, 660, 660, 660, 660, 660,
+    65535, 659, 658, 658, 657, 657, 657, 657, 656, 656, 656, 656, 656, 656, 656, 656, 655, 655, 655,
+    655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 65535, 65535, 65535, 654,
+    65535, 653, 652, 652, 65535, 651, 650, 650, 649, 649, 649, 649, 65535, 648, 647, 647, 646, 646,
+    646, 646, 645, 645, 645, 645, 645, 645, 645, 645, 65535, 644, 643, 643, 642, 642, 642, 642, 641,
+    641, 641, 641, 641, 641, 641, 641, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640,
+    640, 640, 640, 640, 65535, 639, 638, 638, 637, 637, 637, 637, 636, 636, 636, 636, 636, 636, 636,
+    636, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 634, 634,
+    634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634,
+    634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 65535, 65535, 65535, 633, 65535, 632,
+    631, 631, 65535, 630, 629, 629, 628, 628, 628, 628, 65535, 627, 626, 626, 625, 625, 625, 625,
+    624, 624, 624, 624, 624, 624, 624, 624, 65535, 623, 622, 622, 621, 621, 621, 621, 620, 620, 620,
+    620, 620, 620, 620, 620, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619,
+    619, 619, 65535, 618, 617, 617, 616, 616, 616, 616, 615, 615, 615, 615, 615, 615, 615, 615, 614,
+    614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 65535, 612, 611, 611, 610, 610, 610, 610, 609, 609,
+    609, 609, 609, 609, 609, 609, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608,
+    608, 608, 608, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607,
+    607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607, 606, 606, 606,
+    606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606,
+    606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606,
+    606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606,
+    606, 606, 606, 606, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 605, 65535, 65535, 65535,
+    604, 65535, 603, 602, 602, 65535, 65535, 65535, 601, 65535, 600, 599, 599, 65535, 598, 597, 597,
+    596, 596, 596, 596, 65535, 65535, 65535, 595, 65535, 594, 593, 593, 65535, 592, 591, 591, 590,
+    590, 590, 590, 65535, 589, 588, 588, 587, 587, 587, 587, 586, 586, 586, 586, 586, 586, 586, 586,
+    65535, 65535, 65535, 585, 65535, 584, 583, 583, 65535, 582, 581, 581, 580, 580, 580, 580, 65535,
+    579, 578, 578, 577, 577, 577, 577, 576, 576, 576, 576, 576, 576, 576, 576, 65535, 575, 574, 574,
+    573, 573, 573, 573, 572, 572, 572, 572, 572, 572, 572, 572, 571, 571, 571, 571, 571, 571, 571,
+    571, 571, 571, 571, 571, 571, 571, 571, 571, 65535, 65535, 65535, 570, 65535, 569, 568, 568,
+    65535, 567, 566, 566, 565, 565, 565, 565, 65535, 564, 563, 563, 562, 562, 562, 562, 561, 561,
+    561, 561, 561, 561, 561, 561, 65535, 560, 559, 559, 558, 558, 558, 558, 557, 557, 557, 557, 557,
+    557, 557, 557, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+    65535, 555, 554, 554, 553, 553, 553, 553, 552, 552, 552, 552, 552, 552, 552, 552, 551, 551, 551,
+    551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 550, 550, 550, 550, 550, 550,
+    550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550,
+    550, 550, 550, 550, 550, 550, 550, 65535, 65535, 65535, 549, 65535, 548, 547, 547, 65535, 546,
+    545, 545, 544, 544, 544, 544, 65535, 543, 542, 542, 541, 541, 541, 541, 540, 540, 540, 540, 540,
+    540, 540, 540, 65535, 539, 538, 538, 537, 537, 537, 537, 536, 536, 536, 536, 536, 536, 536, 536,
+    535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535, 65535, 534, 533,
+    533, 532, 532, 532, 532, 531, 531, 531, 531, 531, 531, 531, 531, 530, 530, 530, 530, 530, 530,
+    530, 530, 530, 530, 530, 530, 530, 530, 530, 530, 529, 529, 529, 529, 529, 529, 529, 529, 529,
+    529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529,
+    529, 529, 529, 529, 65535, 528, 527, 527, 526, 526, 526, 526, 525, 525, 525, 525, 525, 525, 525,
+    525, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 523, 523,
+    523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523,
+    523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 522, 522, 522, 522, 522, 522, 522, 522,
+    522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522,
+    522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522,
+    522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 65535,
+    65535, 65535, 521, 65535, 520, 519, 519, 65535, 518, 517, 517, 516, 516, 516, 516, 65535, 515,
+    514, 514, 513, 513, 513, 513, 512, 512, 512, 512, 512, 512, 512, 512, 65535, 511, 510, 510, 509,
+    509, 509, 509, 508, 508, 508, 508, 508, 508, 508, 508, 507, 507, 507, 507, 507, 507, 507, 507,
+    507, 507, 507, 507, 507, 507, 507, 507, 65535, 506, 505, 505, 504, 504, 504, 504, 503, 503, 503,
+    503, 503, 503, 503, 503, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502,
+    502, 502, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501,
+    501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 65535, 500, 499, 499,
+    498, 498, 498, 498, 497, 497, 497, 497, 497, 497, 497, 497, 496, 496, 496, 496, 496, 496, 496,
+    496, 496, 496, 496, 496, 496, 496, 496, 496, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495,
+    495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495,
+    495, 495, 495, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494,
+    494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494,
+    494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494,
+    494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 65535, 493, 492, 492, 491, 491, 491, 491, 490,
+    490, 490, 490, 490, 490, 490, 490, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489,
+    489, 489, 489, 489, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488,
+    488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 487, 487,
+    487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487,
+    487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487,
+    487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487, 487,
+    487, 487, 487, 487, 487, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+    486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+    486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+    486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+    486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+    486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+    486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 485, 65535, 65535, 65535, 484, 65535, 483, 482,
+    482, 65535, 65535, 65535, 481, 65535, 480, 479, 479, 65535, 478, 477, 477, 476, 476, 476, 476,
+    65535, 65535, 65535, 475, 65535, 474, 473, 473, 65535, 472, 471, 471, 470, 470, 470, 470, 65535,
+    469, 468, 468, 467, 467, 467, 467, 466, 466, 466, 466, 466, 466, 466, 466, 65535, 65535, 65535,
+    465, 65535, 464, 463, 463, 65535, 462, 461, 461, 460, 460, 460, 460, 65535, 459, 458, 458, 457,
+    457, 457, 457, 456, 456, 456, 456, 456, 456, 456, 456, 65535, 455, 454, 454, 453, 453, 453, 453,
+    452, 452, 452, 452, 452, 452, 452, 452, 451, 451, 451, 451, 451, 451, 451, 451, 451, 451, 451,
+    451, 451, 451, 451, 451, 65535, 65535, 65535, 450, 65535, 449, 448, 448, 65535, 447, 446, 446,
+    445, 445, 445, 445, 65535, 444, 443, 443, 442, 442, 442, 442, 441, 441, 441, 441, 441, 441, 441,
+    441, 65535, 440, 439, 439, 438, 438, 438, 438, 437, 437, 437, 437, 437, 437, 437, 437, 436, 436,
+    436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 65535, 435, 434, 434, 433,
+    433, 433, 433, 432, 432, 432, 432, 432, 432, 432, 432, 431, 431, 431, 431, 431, 431, 431, 431,
+    431, 431, 431, 431, 431, 431, 431, 431, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+    430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+    430, 430, 65535, 65535, 65535, 429, 65535, 428, 427, 427, 65535, 426, 425, 425, 424, 424, 424,
+    424, 65535, 423, 422, 422, 421, 421, 421, 421, 420, 420, 420, 420, 420, 420, 420, 420, 65535,
+    419, 418, 418, 417, 417, 417, 417, 416, 416, 416, 416, 416, 416, 416, 416, 415, 415, 415, 415,
+    415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 65535, 414, 413, 413, 412, 412, 412,
+    412, 411, 411, 411, 411, 411, 411, 411, 411, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409,
+    409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409,
+    65535, 408, 407, 407, 406, 406, 406, 406, 405, 405, 405, 405, 405, 405, 405, 405, 404, 404, 404,
+    404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 403, 403, 403, 403, 403, 403,
+    403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403,
+    403, 403, 403, 403, 403, 403, 403, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402,
+    402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 65535, 65535, 65535, 401,
+    65535, 400, 399, 399, 65535, 398, 397, 397, 396, 396, 396, 396, 65535, 395, 394, 394, 393, 393,
+    393, 393, 392, 392, 392, 392, 392, 392, 392, 392, 65535, 391, 390, 390, 389, 389, 389, 389, 388,
+    388, 388, 388, 388, 388, 388, 388, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387,
+    387, 387, 387, 387, 65535, 386, 385, 385, 384, 384, 384, 384, 383, 383, 383, 383, 383, 383, 383,
+    383, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 381, 381,
+    381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381,
+    381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 381, 65535, 380, 379, 379, 378, 378, 378, 378,
+    377, 377, 377, 377, 377, 377, 377, 377, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376,
+    376, 376, 376, 376, 376, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+    375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 374,
+    374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374,
+    374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374,
+    374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374,
+    374, 374, 374, 374, 374, 374, 65535, 373, 372, 372, 371, 371, 371, 371, 370, 370, 370, 370, 370,
+    370, 370, 370, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369,
+    368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368,
+    368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 368, 367, 367, 367, 367, 367, 367,
+    367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+    367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+    367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+    367, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+    366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+    366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+    366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+    366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+    366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+    366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 65535, 65535, 65535,
+    365, 65535, 364, 363, 363, 65535, 362, 361, 361, 360, 360, 360, 360, 65535, 359, 358, 358, 357,
+    357, 357, 357, 356, 356, 356, 356, 356, 356, 356, 356, 65535, 355, 354, 354, 353, 353, 353, 353,
+    352, 352, 352, 352, 352, 352, 352, 352, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351,
+    351, 351, 351, 351, 351, 65535, 350, 349, 349, 348, 348, 348, 348, 347, 347, 347, 347, 347, 347,
+    347, 347, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 345,
+    345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345,
+    345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 65535, 344, 343, 343, 342, 342, 342,
+    342, 341, 341, 341, 341, 341, 341, 341, 341, 340, 340, 340, 340, 340, 340, 340, 340, 340, 340,
+    340, 340, 340, 340, 340, 340, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+    339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 338,
+    338, 338, 338, 338, 338, 338, 338, 65535, 337, 336, 336, 335, 335, 335, 335, 334, 334, 334, 334,
+    334, 334, 334, 334, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333,
+    333, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+    332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 331, 331, 331, 331, 331,
+    331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331,
+    331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331,
+    331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331, 331,
+    331, 331, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+    330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+    330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+    330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+    330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+    330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+    330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 65535, 329, 328,
+    328, 327, 327, 327, 327, 326, 326, 326, 326, 326, 326, 326, 326, 325, 325, 325, 325, 325, 325,
+    325, 325, 325, 325, 325, 325, 325, 325, 325, 325, 324, 324, 324, 324, 324, 324, 324, 324, 324,
+    324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324,
+    324, 324, 324, 324, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323,
+    323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323,
+    323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323,
+    323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 322, 322, 322, 322, 322, 322, 322, 322,
+    322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+    322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+    322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+    322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+    322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+    322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+    322, 322, 322, 322, 322, 322, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+};
+
+const uint16_t high_card_rank_table[8192] = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7461, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 7460, 65535, 65535, 65535, 7459, 65535, 7458, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7457, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 7456, 65535, 65535, 65535, 7455, 65535, 7454, 7453,
+    7453, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7452, 65535, 65535, 65535, 7451, 65535,
+    7450, 7449, 7449, 65535, 65535, 65535, 7448, 65535, 7447, 7446, 7446, 65535, 7445, 7444, 7444,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 7443, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    7442, 65535, 65535, 65535, 7441, 65535, 7440, 7439, 7439, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 7438, 65535, 65535, 65535, 7437, 65535, 7436, 7435, 7435, 65535, 65535, 65535,
+    7434, 65535, 7433, 7432, 7432, 65535, 7431, 7430, 7430, 7429, 7429, 7429, 7429, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 7428, 65535, 65535, 65535, 7427, 65535, 7426, 7425, 7425,
+    65535, 65535, 65535, 7424, 65535, 7423, 7422, 7422, 65535, 7421, 7420, 7420, 7419, 7419, 7419,
+    7419, 65535, 65535, 65535, 7418, 65535, 7417, 7416, 7416, 65535, 7415, 7414, 7414, 7413, 7413,
+    7413, 7413, 65535, 7412, 7411, 7411, 7410, 7410, 7410, 7410, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 7409, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7408,
+    65535, 65535, 65535, 7407, 65535, 7406, 7405, 7405, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 7404, 65535, 65535, 65535, 7403, 65535, 7402, 7401, 7401, 65535, 65535, 65535, 7400,
+    65535, 7399, 7398, 7398, 65535, 7397, 7396, 7396, 7395, 7395, 7395, 7395, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 7394, 65535, 65535, 65535, 7393, 65535, 7392, 7391, 7391, 65535,
+    65535, 65535, 7390, 65535, 7389, 7388, 7388, 65535, 7387, 7386, 7386, 7385, 7385, 7385, 7385,
+    65535, 65535, 65535, 7384, 65535, 7383, 7382, 7382, 65535, 7381, 7380, 7380, 7379, 7379, 7379,
+    7379, 65535, 7378, 7377, 7377, 7376, 7376, 7376, 7376, 7375, 7375, 7375, 7375, 7375, 7375, 7375,
+    7375, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7374, 65535, 65535, 65535, 7373, 65535,
+    7372, 7371, 7371, 65535, 65535, 65535, 7370, 65535, 7369, 7368, 7368, 65535, 7367, 7366, 7366,
+    7365, 7365, 7365, 7365, 65535, 65535, 65535, 7364, 65535, 7363, 7362, 7362, 65535, 7361, 7360,
+    7360, 7359, 7359, 7359, 7359, 65535, 7358, 7357, 7357, 7356, 7356, 7356, 7356, 7355, 7355, 7355,
+    7355, 7355, 7355, 7355, 7355, 65535, 65535, 65535, 7354, 65535, 7353, 7352, 7352, 65535, 7351,
+    7350, 7350, 7349, 7349, 7349, 7349, 65535, 7348, 7347, 7347, 7346, 7346, 7346, 7346, 7345, 7345,
+    7345, 7345, 7345, 7345, 7345, 7345, 65535, 7344, 7343, 7343, 7342, 7342, 7342, 7342, 7341, 7341,
+    7341, 7341, 7341, 7341, 7341, 7341, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7340, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 7339, 65535, 65535, 65535, 7338, 65535, 7337, 7336, 7336, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 7335, 65535, 65535, 65535, 7334, 65535, 7333, 7332,
+    7332, 65535, 65535, 65535, 7331, 65535, 7330, 7329, 7329, 65535, 7328, 7327, 7327, 7326, 7326,
+    7326, 7326, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7325, 65535, 65535, 65535, 7324,
+    65535, 7323, 7322, 7322, 65535, 65535, 65535, 7321, 65535, 7320, 7319, 7319, 65535, 7318, 7317,
+    7317, 7316, 7316, 7316, 7316, 65535, 65535, 65535, 7315, 65535, 7314, 7313, 7313, 65535, 7312,
+    7311, 7311, 7310, 7310, 7310, 7310, 65535, 7309, 7308, 7308, 7307, 7307, 7307, 7307, 7306, 7306,
+    7306, 7306, 7306, 7306, 7306, 7306, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7305,
+    65535, 65535, 65535, 7304, 65535, 7303, 7302, 7302, 65535, 65535, 65535, 7301, 65535, 7300,
+    7299, 7299, 65535, 7298, 7297, 7297, 7296, 7296, 7296, 7296, 65535, 65535, 65535, 7295, 65535,
+    7294, 7293, 7293, 65535, 7292, 7291, 7291, 7290, 7290, 7290, 7290, 65535, 7289, 7288, 7288,
+    7287, 7287, 7287, 7287, 7286, 7286, 7286, 7286, 7286, 7286, 7286, 7286, 65535, 65535, 65535,
+    7285, 65535, 7284, 7283, 7283, 65535, 7282, 7281, 7281, 7280, 7280, 7280, 7280, 65535, 7279,
+    7278, 7278, 7277, 7277, 7277, 7277, 7276, 7276, 7276, 7276, 7276, 7276, 7276, 7276, 65535, 7275,
+    7274, 7274, 7273, 7273, 7273, 7273, 7272, 7272, 7272, 7272, 7272, 7272, 7272, 7272, 7271, 7271,
+    7271, 7271, 7271, 7271, 7271, 7271, 7271, 7271, 7271, 7271, 7271, 7271, 7271, 7271, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 7270, 65535, 65535, 65535, 7269, 65535, 7268, 7267,
+    7267, 65535, 65535, 65535, 7266, 65535, 7265, 7264, 7264, 65535, 7263, 7262, 7262, 7261, 7261,
+    7261, 7261, 65535, 65535, 65535, 7260, 65535, 7259, 7258, 7258, 65535, 7257, 7256, 7256, 7255,
+    7255, 7255, 7255, 65535, 7254, 7253, 7253, 7252, 7252, 7252, 7252, 7251, 7251, 7251, 7251, 7251,
+    7251, 7251, 7251, 65535, 65535, 65535, 7250, 65535, 7249, 7248, 7248, 65535, 7247, 7246, 7246,
+    7245, 7245, 7245, 7245, 65535, 7244, 7243, 7243, 7242, 7242, 7242, 7242, 7241, 7241, 7241, 7241,
+    7241, 7241, 7241, 7241, 65535, 7240, 7239, 7239, 7238, 7238, 7238, 7238, 7237, 7237, 7237, 7237,
+    7237, 7237, 7237, 7237, 7236, 7236, 7236, 7236, 7236, 7236, 7236, 7236, 7236, 7236, 7236, 7236,
+    7236, 7236, 7236, 7236, 65535, 65535, 65535, 7235, 65535, 7234, 7233, 7233, 65535, 7232, 7231,
+    7231, 7230, 7230, 7230, 7230, 65535, 7229, 7228, 7228, 7227, 7227, 7227, 7227, 7226, 7226, 7226,
+    7226, 7226, 7226, 7226, 7226, 65535, 7225, 7224, 7224, 7223, 7223, 7223, 7223, 7222, 7222, 7222,
+    7222, 7222, 7222, 7222, 7222, 7221, 7221, 7221, 7221, 7221, 7221, 7221, 7221, 7221, 7221, 7221,
+    7221, 7221, 7221, 7221, 7221, 65535, 7220, 7219, 7219, 7218, 7218, 7218, 7218, 7217, 7217, 7217,
+    7217, 7217, 7217, 7217, 7217, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216,
+    7216, 7216, 7216, 7216, 7216, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7215, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 7214, 65535, 65535, 65535, 7213, 65535, 7212, 7211,
+    7211, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7210, 65535, 65535, 65535, 7209, 65535,
+    7208, 7207, 7207, 65535, 65535, 65535, 7206, 65535, 7205, 7204, 7204, 65535, 7203, 7202, 7202,
+    7201, 7201, 7201, 7201, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7200, 65535, 65535,
+    65535, 7199, 65535, 7198, 7197, 7197, 65535, 65535, 65535, 7196, 65535, 7195, 7194, 7194, 65535,
+    7193, 7192, 7192, 7191, 7191, 7191, 7191, 65535, 65535, 65535, 7190, 65535, 7189, 7188, 7188,
+    65535, 7187, 7186, 7186, 7185, 7185, 7185, 7185, 65535, 7184, 7183, 7183, 7182, 7182, 7182,
+    7182, 7181, 7181, 7181, 7181, 7181, 7181, 7181, 7181, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 7180, 65535, 65535, 65535, 7179, 65535, 7178, 7177, 7177, 65535, 65535, 65535, 7176,
+    65535, 7175, 7174, 7174, 65535, 7173, 7172, 7172, 7171, 7171, 7171, 7171, 65535, 65535, 65535,
+    7170, 65535, 7169, 7168, 7168, 65535, 7167, 7166, 7166, 7165, 7165, 7165, 7165, 65535, 7164,
+    7163, 7163, 7162, 7162, 7162, 7162, 7161, 7161, 7161, 7161, 7161, 7161, 7161, 7161, 65535,
+    65535, 65535, 7160, 65535, 7159, 7158, 7158, 65535, 7157, 7156, 7156, 7155, 7155, 7155, 7155,
+    65535, 7154, 7153, 7153, 7152, 7152, 7152, 7152, 7151, 7151, 7151, 7151, 7151, 7151, 7151, 7151,
+    65535, 7150, 7149, 7149, 7148, 7148, 7148, 7148, 7147, 7147, 7147, 7147, 7147, 7147, 7147, 7147,
+    7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146, 7146,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 7145, 65535, 65535, 65535, 7144, 65535, 7143,
+    7142, 7142, 65535, 65535, 65535, 7141, 65535, 7140, 7139, 7139, 65535, 7138, 7137, 7137, 7136,
+    7136, 7136, 7136, 65535, 65535, 65535, 7135, 65535, 7134, 7133, 7133, 65535, 7132, 7131, 7131,
+    7130, 7130, 7130, 7130, 65535, 7129, 7128, 7128, 7127, 7127, 7127, 7127, 7126, 7126, 7126, 7126,
+    7126, 7126, 7126, 7126, 65535, 65535, 65535, 7125, 65535, 7124, 7123, 7123, 65535, 7122, 7121,
+    7121, 7120, 7120, 7120, 7120, 65535, 7119, 7118, 7118, 7117, 7117, 7117, 7117, 7116, 7116, 7116,
+    7116, 7116, 7116, 7116, 7116, 65535, 7115, 7114, 7114, 7113, 7113, 7113, 7113, 7112, 7112, 7112,
+    7112, 7112, 7112, 7112, 7112, 7111, 7111, 7111, 7111, 7111, 7111, 7111, 7111, 7111, 7111, 7111,
+    7111, 7111, 7111, 7111, 7111, 65535, 65535, 65535, 7110, 65535, 7109, 7108, 7108, 65535, 7107,
+    7106, 7106, 7105, 7105, 7105, 7105, 65535, 7104, 7103, 7103, 7102, 7102, 7102, 7102, 7101, 7101,
+    7101, 7101, 7101, 7101, 7101, 7101, 65535, 7100, 7099, 7099, 7098, 7098, 7098, 7098, 7097, 7097,
+    7097, 7097, 7097, 7097, 7097, 7097, 7096, 7096, 7096, 7096, 7096, 7096, 7096, 7096, 7096, 7096,
+    7096, 7096, 7096, 7096, 7096, 7096, 65535, 7095, 7094, 7094, 7093, 7093, 7093, 7093, 7092, 7092,
+    7092, 7092, 7092, 7092, 7092, 7092, 7091, 7091, 7091, 7091, 7091, 7091, 7091, 7091, 7091, 7091,
+    7091, 7091, 7091, 7091, 7091, 7091, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090,
+    7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090, 7090,
+    7090, 7090, 7090, 7090, 7090, 7090, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7089,
+    65535, 65535, 65535, 7088, 65535, 7087, 7086, 7086, 65535, 65535, 65535, 7085, 65535, 7084,
+    7083, 7083, 65535, 7082, 7081, 7081, 7080, 7080, 7080, 7080, 65535, 65535, 65535, 7079, 65535,
+    7078, 7077, 7077, 65535, 7076, 7075, 7075, 7074, 7074, 7074, 7074, 65535, 7073, 7072, 7072,
+    7071, 7071, 7071, 7071, 7070, 7070, 7070, 7070, 7070, 7070, 7070, 7070, 65535, 65535, 65535,
+    7069, 65535, 7068, 7067, 7067, 65535, 7066, 7065, 7065, 7064, 7064, 7064, 7064, 65535, 7063,
+    7062, 7062, 7061, 7061, 7061, 7061, 7060, 7060, 7060, 7060, 7060, 7060, 7060, 7060, 65535, 7059,
+    7058, 7058, 7057, 7057, 7057, 7057, 7056, 7056, 7056, 7056, 7056, 7056, 7056, 7056, 7055, 7055,
+    7055, 7055, 7055, 7055, 7055, 7055, 7055, 7055, 7055, 7055, 7055, 7055, 7055, 7055, 65535,
+    65535, 65535, 7054, 65535, 7053, 7052, 7052, 65535, 7051, 7050, 7050, 7049, 7049, 7049, 7049,
+    65535, 7048, 7047, 7047, 7046, 7046, 7046, 7046, 7045, 7045, 7045, 7045, 7045, 7045, 7045, 7045,
+    65535, 7044, 7043, 7043, 7042, 7042, 7042, 7042, 7041, 7041, 7041, 7041, 7041, 7041, 7041, 7041,
+    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
+    65535, 7039, 7038, 7038, 7037, 7037, 7037, 7037, 7036, 7036, 7036, 7036, 7036, 7036, 7036, 7036,
+    7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035, 7035,
+    7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034,
+    7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034, 7034,
+    65535, 65535, 65535, 7033, 65535, 7032, 7031, 7031, 65535, 7030, 7029, 7029, 7028, 7028, 7028,
+    7028, 65535, 7027, 7026, 7026, 7025, 7025, 7025, 7025, 7024, 7024, 7024, 7024, 7024, 7024, 7024,
+    7024, 65535, 7023, 7022, 7022, 7021, 7021, 7021, 7021, 7020, 7020, 7020, 7020, 7020, 7020, 7020,
+    7020, 7019, 7019, 7019, 7019, 7019, 7019, 7019, 7019, 7019, 7019, 7019, 7019, 7019, 7019, 7019,
+    7019, 65535, 7018, 7017, 7017, 7016, 7016, 7016, 7016, 7015, 7015, 7015, 7015, 7015, 7015, 7015,
+    7015, 7014, 7014, 7014, 7014, 7014, 7014, 7014, 7014, 7014, 7014, 7014, 7014, 7014, 7014, 7014,
+    7014, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013,
+    7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013, 7013,
+    7013, 65535, 7012, 7011, 7011, 7010, 7010, 7010, 7010, 7009, 7009, 7009, 7009, 7009, 7009, 7009,
+    7009, 7008, 7008, 7008, 7008, 7008, 7008, 7008, 7008, 7008, 7008, 7008, 7008, 7008, 7008, 7008,
+    7008, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007,
+    7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007, 7007,
+    7007, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 7006, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7005, 65535, 65535, 65535, 7004,
+    65535, 7003, 7002, 7002, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 7001, 65535, 65535,
+    65535, 7000, 65535, 6999, 6998, 6998, 65535, 65535, 65535, 6997, 65535, 6996, 6995, 6995, 65535,
+    6994, 6993, 6993, 6992, 6992, 6992, 6992, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6991,
+    65535, 65535, 65535, 6990, 65535, 6989, 6988, 6988, 65535, 65535, 65535, 6987, 65535, 6986,
+    6985, 6985, 65535, 6984, 6983, 6983, 6982, 6982, 6982, 6982, 65535, 65535, 65535, 6981, 65535,
+    6980, 6979, 6979, 65535, 6978, 6977, 6977, 6976, 6976, 6976, 6976, 65535, 6975, 6974, 6974,
+    6973, 6973, 6973, 6973, 6972, 6972, 6972, 6972, 6972, 6972, 6972, 6972, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 6971, 65535, 65535, 65535, 6970, 65535, 6969, 6968, 6968, 65535,
+    65535, 65535, 6967, 65535, 6966, 6965, 6965, 65535, 6964, 6963, 6963, 6962, 6962, 6962, 6962,
+    65535, 65535, 65535, 6961, 65535, 6960, 6959, 6959, 65535, 6958, 6957, 6957, 6956, 6956, 6956,
+    6956, 65535, 6955, 6954, 6954, 6953, 6953, 6953, 6953, 6952, 6952, 6952, 6952, 6952, 6952, 6952,
+    6952, 65535, 65535, 65535, 6951, 65535, 6950, 6949, 6949, 65535, 6948, 6947, 6947, 6946, 6946,
+    6946, 6946, 65535, 6945, 6944, 6944, 6943, 6943, 6943, 6943, 6942, 6942, 6942, 6942, 6942, 6942,
+    6942, 6942, 65535, 6941, 6940, 6940, 6939, 6939, 6939, 6939, 6938, 6938, 6938, 6938, 6938, 6938,
+    6938, 6938, 6937, 6937, 6937, 6937, 6937, 6937, 6937, 6937, 6937, 6937, 6937, 6937, 6937, 6937,
+    6937, 6937, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6936, 65535, 65535, 65535, 6935,
+    65535, 6934, 6933, 6933, 65535, 65535, 65535, 6932, 65535, 6931, 6930, 6930, 65535, 6929, 6928,
+    6928, 6927, 6927, 6927, 6927, 65535, 65535, 65535, 6926, 65535, 6925, 6924, 6924, 65535, 6923,
+    6922, 6922, 6921, 6921, 6921, 6921, 65535, 6920, 6919, 6919, 6918, 6918, 6918, 6918, 6917, 6917,
+    6917, 6917, 6917, 6917, 6917, 6917, 65535, 65535, 65535, 6916, 65535, 6915, 6914, 6914, 65535,
+    6913, 6912, 6912, 6911, 6911, 6911, 6911, 65535, 6910, 6909, 6909, 6908, 6908, 6908, 6908, 6907,
+    6907, 6907, 6907, 6907, 6907, 6907, 6907, 65535, 6906, 6905, 6905, 6904, 6904, 6904, 6904, 6903,
+    6903, 6903, 6903, 6903, 6903, 6903, 6903, 6902, 6902, 6902, 6902, 6902, 6902, 6902, 6902, 6902,
+    6902, 6902, 6902, 6902, 6902, 6902, 6902, 65535, 65535, 65535, 6901, 65535, 6900, 6899, 6899,
+    65535, 6898, 6897, 6897, 6896, 6896, 6896, 6896, 65535, 6895, 6894, 6894, 6893, 6893, 6893,
+    6893, 6892, 6892, 6892, 6892, 6892, 6892, 6892, 6892, 65535, 6891, 6890, 6890, 6889, 6889, 6889,
+    6889, 6888, 6888, 6888, 6888, 6888, 6888, 6888, 6888, 6887, 6887, 6887, 6887, 6887, 6887, 6887,
+    6887, 6887, 6887, 6887, 6887, 6887, 6887, 6887, 6887, 65535, 6886, 6885, 6885, 6884, 6884, 6884,
+    6884, 6883, 6883, 6883, 6883, 6883, 6883, 6883, 6883, 6882, 6882, 6882, 6882, 6882, 6882, 6882,
+    6882, 6882, 6882, 6882, 6882, 6882, 6882, 6882, 6882, 6881, 6881, 6881, 6881, 6881, 6881, 6881,
+    6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881,
+    6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 6881, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 6880, 65535, 65535, 65535, 6879, 65535, 6878, 6877, 6877, 65535, 65535, 65535, 6876,
+    65535, 6875, 6874, 6874, 65535, 6873, 6872, 6872, 6871, 6871, 6871, 6871, 65535, 65535, 65535,
+    6870, 65535, 6869, 6868, 6868, 65535, 6867, 6866, 6866, 6865, 6865, 6865, 6865, 65535, 6864,
+    6863, 6863, 6862, 6862, 6862, 6862, 6861, 6861, 6861, 6861, 6861, 6861, 6861, 6861, 65535,
+    65535, 65535, 6860, 65535, 6859, 6858, 6858, 65535, 6857, 6856, 6856, 6855, 6855, 6855, 6855,
+    65535, 6854, 6853, 6853, 6852, 6852, 6852, 6852, 6851, 6851, 6851, 6851, 6851, 6851, 6851, 6851,
+    65535, 6850, 6849, 6849, 6848, 6848, 6848, 6848, 6847, 6847, 6847, 6847, 6847, 6847, 6847, 6847,
+    6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846, 6846,
+    65535, 65535, 65535, 6845, 65535, 6844, 6843, 6843, 65535, 6842, 6841, 6841, 6840, 6840, 6840,
+    6840, 65535, 6839, 6838, 6838, 6837, 6837, 6837, 6837, 6836, 6836, 6836, 6836, 6836, 6836, 6836,
+    6836, 65535, 6835, 6834, 6834, 6833, 6833, 6833, 6833, 6832, 6832, 6832, 6832, 6832, 6832, 6832,
+    6832, 6831, 6831, 6831, 6831, 6831, 6831, 6831, 6831, 6831, 6831, 6831, 6831, 6831, 6831, 6831,
+    6831, 65535, 6830, 6829, 6829, 6828, 6828, 6828, 6828, 6827, 6827, 6827, 6827, 6827, 6827, 6827,
+    6827, 6826, 6826, 6826, 6826, 6826, 6826, 6826, 6826, 6826, 6826, 6826, 6826, 6826, 6826, 6826,
+    6826, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825,
+    6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825, 6825,
+    6825, 65535, 65535, 65535, 6824, 65535, 6823, 6822, 6822, 65535, 6821, 6820, 6820, 6819, 6819,
+    6819, 6819, 65535, 6818, 6817, 6817, 6816, 6816, 6816, 6816, 6815, 6815, 6815, 6815, 6815, 6815,
+    6815, 6815, 65535, 6814, 6813, 6813, 6812, 6812, 6812, 6812, 6811, 6811, 6811, 6811, 6811, 6811,
+    6811, 6811, 6810, 6810, 6810, 6810, 6810, 6810, 6810, 6810, 6810, 6810, 6810, 6810, 6810, 6810,
+    6810, 6810, 65535, 6809, 6808, 6808, 6807, 6807, 6807, 6807, 6806, 6806, 6806, 6806, 6806, 6806,
+    6806, 6806, 6805, 6805, 6805, 6805, 6805, 6805, 6805, 6805, 6805, 6805, 6805, 6805, 6805, 6805,
+    6805, 6805, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804,
+    6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804, 6804,
+    6804, 6804, 65535, 6803, 6802, 6802, 6801, 6801, 6801, 6801, 6800, 6800, 6800, 6800, 6800, 6800,
+    6800, 6800, 6799, 6799, 6799, 6799, 6799, 6799, 6799, 6799, 6799, 6799, 6799, 6799, 6799, 6799,
+    6799, 6799, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798,
+    6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798, 6798,
+    6798, 6798, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797,
+    6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797,
+    6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797,
+    6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797, 6797,
+    6797, 6797, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6796, 65535, 65535, 65535, 6795,
+    65535, 6794, 6793, 6793, 65535, 65535, 65535, 6792, 65535, 6791, 6790, 6790, 65535, 6789, 6788,
+    6788, 6787, 6787, 6787, 6787, 65535, 65535, 65535, 6786, 65535, 6785, 6784, 6784, 65535, 6783,
+    6782, 6782, 6781, 6781, 6781, 6781, 65535, 6780, 6779, 6779, 6778, 6778, 6778, 6778, 6777, 6777,
+    6777, 6777, 6777, 6777, 6777, 6777, 65535, 65535, 65535, 6776, 65535, 6775, 6774, 6774, 65535,
+    6773, 6772, 6772, 6771, 6771, 6771, 6771, 65535, 6770, 6769, 6769, 6768, 6768, 6768, 6768, 6767,
+    6767, 6767, 6767, 6767, 6767, 6767, 6767, 65535, 6766, 6765, 6765, 6764, 6764, 6764, 6764, 6763,
+    6763, 6763, 6763, 6763, 6763, 6763, 6763, 6762, 6762, 6762, 6762, 6762, 6762, 6762, 6762, 6762,
+    6762, 6762, 6762, 6762, 6762, 6762, 6762, 65535, 65535, 65535, 6761, 65535, 6760, 6759, 6759,
+    65535, 6758, 6757, 6757, 6756, 6756, 6756, 6756, 65535, 6755, 6754, 6754, 6753, 6753, 6753,
+    6753, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 65535, 6751, 6750, 6750, 6749, 6749, 6749,
+    6749, 6748, 6748, 6748, 6748, 6748, 6748, 6748, 6748, 6747, 6747, 6747, 6747, 6747, 6747, 6747,
+    6747, 6747, 6747, 6747, 6747, 6747, 6747, 6747, 6747, 65535, 6746, 6745, 6745, 6744, 6744, 6744,
+    6744, 6743, 6743, 6743, 6743, 6743, 6743, 6743, 6743, 6742, 6742, 6742, 6742, 6742, 6742, 6742,
+    6742, 6742, 6742, 6742, 6742, 6742, 6742, 6742, 6742, 6741, 6741, 6741, 6741, 6741, 6741, 6741,
+    6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741,
+    6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 6741, 65535, 65535, 65535, 6740, 65535, 6739,
+    6738, 6738, 65535, 6737, 6736, 6736, 6735, 6735, 6735, 6735, 65535, 6734, 6733, 6733, 6732,
+    6732, 6732, 6732, 6731, 6731, 6731, 6731, 6731, 6731, 6731, 6731, 65535, 6730, 6729, 6729, 6728,
+    6728, 6728, 6728, 6727, 6727, 6727, 6727, 6727, 6727, 6727, 6727, 6726, 6726, 6726, 6726, 6726,
+    6726, 6726, 6726, 6726, 6726, 6726, 6726, 6726, 6726, 6726, 6726, 65535, 6725, 6724, 6724, 6723,
+    6723, 6723, 6723, 6722, 6722, 6722, 6722, 6722, 6722, 6722, 6722, 6721, 6721, 6721, 6721, 6721,
+    6721, 6721, 6721, 6721, 6721, 6721, 6721, 6721, 6721, 6721, 6721, 6720, 6720, 6720, 6720, 6720,
+    6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720,
+    6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 6720, 65535, 6719, 6718, 6718, 6717,
+    6717, 6717, 6717, 6716, 6716, 6716, 6716, 6716, 6716, 6716, 6716, 6715, 6715, 6715, 6715, 6715,
+    6715, 6715, 6715, 6715, 6715, 6715, 6715, 6715, 6715, 6715, 6715, 6714, 6714, 6714, 6714, 6714,
+    6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714,
+    6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6714, 6713, 6713, 6713, 6713, 6713,
+    6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713,
+    6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713,
+    6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713,
+    6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 6713, 65535, 65535, 65535, 6712,
+    65535, 6711, 6710, 6710, 65535, 6709, 6708, 6708, 6707, 6707, 6707, 6707, 65535, 6706, 6705,
+    6705, 6704, 6704, 6704, 6704, 6703, 6703, 6703, 6703, 6703, 6703, 6703, 6703, 65535, 6702, 6701,
+    6701, 6700, 6700, 6700, 6700, 6699, 6699, 6699, 6699, 6699, 6699, 6699, 6699, 6698, 6698, 6698,
+    6698, 6698, 6698, 6698, 6698, 6698, 6698, 6698, 6698, 6698, 6698, 6698, 6698, 65535, 6697, 6696,
+    6696, 6695, 6695, 6695, 6695, 6694, 6694, 6694, 6694, 6694, 6694, 6694, 6694, 6693, 6693, 6693,
+    6693, 6693, 6693, 6693, 6693, 6693, 6693, 6693, 6693, 6693, 6693, 6693, 6693, 6692, 6692, 6692,
+    6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692,
+    6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 6692, 65535, 6691, 6690,
+    6690, 6689, 6689, 6689, 6689, 6688, 6688, 6688, 6688, 6688, 6688, 6688, 6688, 6687, 6687, 6687,
+    6687, 6687, 6687, 6687, 6687, 6687, 6687, 6687, 6687, 6687, 6687, 6687, 6687, 6686, 6686, 6686,
+    6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686,
+    6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6686, 6685, 6685, 6685,
+    6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685,
+    6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685,
+    6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685,
+    6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 6685, 65535, 6684, 6683,
+    6683, 6682, 6682, 6682, 6682, 6681, 6681, 6681, 6681, 6681, 6681, 6681, 6681, 6680, 6680, 6680,
+    6680, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6679, 6679, 6679,
+    6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679,
+    6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6679, 6678, 6678, 6678,
+    6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678,
+    6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678,
+    6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678,
+    6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 6678, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 6677, 65535, 65535, 65535, 6676, 65535, 6675, 6674,
+    6674, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6673, 65535, 65535, 65535, 6672, 65535,
+    6671, 6670, 6670, 65535, 65535, 65535, 6669, 65535, 6668, 6667, 6667, 65535, 6666, 6665, 6665,
+    6664, 6664, 6664, 6664, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6663, 65535, 65535,
+    65535, 6662, 65535, 6661, 6660, 6660, 65535, 65535, 65535, 6659, 65535, 6658, 6657, 6657, 65535,
+    6656, 6655, 6655, 6654, 6654, 6654, 6654, 65535, 65535, 65535, 6653, 65535, 6652, 6651, 6651,
+    65535, 6650, 6649, 6649, 6648, 6648, 6648, 6648, 65535, 6647, 6646, 6646, 6645, 6645, 6645,
+    6645, 6644, 6644, 6644, 6644, 6644, 6644, 6644, 6644, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 6643, 65535, 65535, 65535, 6642, 65535, 6641, 6640, 6640, 65535, 65535, 65535, 6639,
+    65535, 6638, 6637, 6637, 65535, 6636, 6635, 6635, 6634, 6634, 6634, 6634, 65535, 65535, 65535,
+    6633, 65535, 6632, 6631, 6631, 65535, 6630, 6629, 6629, 6628, 6628, 6628, 6628, 65535, 6627,
+    6626, 6626, 6625, 6625, 6625, 6625, 6624, 6624, 6624, 6624, 6624, 6624, 6624, 6624, 65535,
+    65535, 65535, 6623, 65535, 6622, 6621, 6621, 65535, 6620, 6619, 6619, 6618, 6618, 6618, 6618,
+    65535, 6617, 6616, 6616, 6615, 6615, 6615, 6615, 6614, 6614, 6614, 6614, 6614, 6614, 6614, 6614,
+    65535, 6613, 6612, 6612, 6611, 6611, 6611, 6611, 6610, 6610, 6610, 6610, 6610, 6610, 6610, 6610,
+    6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609, 6609,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 6608, 65535, 65535, 65535, 6607, 65535, 6606,
+    6605, 6605, 65535, 65535, 65535, 6604, 65535, 6603, 6602, 6602, 65535, 6601, 6600, 6600, 6599,
+    6599, 6599, 6599, 65535, 65535, 65535, 6598, 65535, 6597, 6596, 6596, 65535, 6595, 6594, 6594,
+    6593, 6593, 6593, 6593, 65535, 6592, 6591, 6591, 6590, 6590, 6590, 6590, 6589, 6589, 6589, 6589,
+    6589, 6589, 6589, 6589, 65535, 65535, 65535, 6588, 65535, 6587, 6586, 6586, 65535, 6585, 6584,
+    6584, 6583, 6583, 6583, 6583, 65535, 6582, 6581, 6581, 6580, 6580, 6580, 6580, 6579, 6579, 6579,
+    6579, 6579, 6579, 6579, 6579, 65535, 6578, 6577, 6577, 6576, 6576, 6576, 6576, 6575, 6575, 6575,
+    6575, 6575, 6575, 6575, 6575, 6574, 6574, 6574, 6574, 6574, 6574, 6574, 6574, 6574, 6574, 6574,
+    6574, 6574, 6574, 6574, 6574, 65535, 65535, 65535, 6573, 65535, 6572, 6571, 6571, 65535, 6570,
+    6569, 6569, 6568, 6568, 6568, 6568, 65535, 6567, 6566, 6566, 6565, 6565, 6565, 6565, 6564, 6564,
+    6564, 6564, 6564, 6564, 6564, 6564, 65535, 6563, 6562, 6562, 6561, 6561, 6561, 6561, 6560, 6560,
+    6560, 6560, 6560, 6560, 6560, 6560, 6559, 6559, 6559, 6559, 6559, 6559, 6559, 6559, 6559, 6559,
+    6559, 6559, 6559, 6559, 6559, 6559, 65535, 6558, 6557, 6557, 6556, 6556, 6556, 6556, 6555, 6555,
+    6555, 6555, 6555, 6555, 6555, 6555, 6554, 6554, 6554, 6554, 6554, 6554, 6554, 6554, 6554, 6554,
+    6554, 6554, 6554, 6554, 6554, 6554, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553,
+    6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553, 6553,
+    6553, 6553, 6553, 6553, 6553, 6553, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6552,
+    65535, 65535, 65535, 6551, 65535, 6550, 6549, 6549, 65535, 65535, 65535, 6548, 65535, 6547,
+    6546, 6546, 65535, 6545, 6544, 6544, 6543, 6543, 6543, 6543, 65535, 65535, 65535, 6542, 65535,
+    6541, 6540, 6540, 65535, 6539, 6538, 6538, 6537, 6537, 6537, 6537, 65535, 6536, 6535, 6535,
+    6534, 6534, 6534, 6534, 6533, 6533, 6533, 6533, 6533, 6533, 6533, 6533, 65535, 65535, 65535,
+    6532, 65535, 6531, 6530, 6530, 65535, 6529, 6528, 6528, 6527, 6527, 6527, 6527, 65535, 6526,
+    6525, 6525, 6524, 6524, 6524, 6524, 6523, 6523, 6523, 6523, 6523, 6523, 6523, 6523, 65535, 6522,
+    6521, 6521, 6520, 6520, 6520, 6520, 6519, 6519, 6519, 6519, 6519, 6519, 6519, 6519, 6518, 6518,
+    6518, 6518, 6518, 6518, 6518, 6518, 6518, 6518, 6518, 6518, 6518, 6518, 6518, 6518, 65535,
+    65535, 65535, 6517, 65535, 6516, 6515, 6515, 65535, 6514, 6513, 6513, 6512, 6512, 6512, 6512,
+    65535, 6511, 6510, 6510, 6509, 6509, 6509, 6509, 6508, 6508, 6508, 6508, 6508, 6508, 6508, 6508,
+    65535, 6507, 6506, 6506, 6505, 6505, 6505, 6505, 6504, 6504, 6504, 6504, 6504, 6504, 6504, 6504,
+    6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503, 6503,
+    65535, 6502, 6501, 6501, 6500, 6500, 6500, 6500, 6499, 6499, 6499, 6499, 6499, 6499, 6499, 6499,
+    6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498, 6498,
+    6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497,
+    6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497, 6497,
+    65535, 65535, 65535, 6496, 65535, 6495, 6494, 6494, 65535, 6493, 6492, 6492, 6491, 6491, 6491,
+    6491, 65535, 6490, 6489, 6489, 6488, 6488, 6488, 6488, 6487, 6487, 6487, 6487, 6487, 6487, 6487,
+    6487, 65535, 6486, 6485, 6485, 6484, 6484, 6484, 6484, 6483, 6483, 6483, 6483, 6483, 6483, 6483,
+    6483, 6482, 6482, 6482, 6482, 6482, 6482, 6482, 6482, 6482, 6482, 6482, 6482, 6482, 6482, 6482,
+    6482, 65535, 6481, 6480, 6480, 6479, 6479, 6479, 6479, 6478, 6478, 6478, 6478, 6478, 6478, 6478,
+    6478, 6477, 6477, 6477, 6477, 6477, 6477, 6477, 6477, 6477, 6477, 6477, 6477, 6477, 6477, 6477,
+    6477, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476,
+    6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476, 6476,
+    6476, 65535, 6475, 6474, 6474, 6473, 6473, 6473, 6473, 6472, 6472, 6472, 6472, 6472, 6472, 6472,
+    6472, 6471, 6471, 6471, 6471, 6471, 6471, 6471, 6471, 6471, 6471, 6471, 6471, 6471, 6471, 6471,
+    6471, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470,
+    6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470, 6470,
+    6470, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469,
+    6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469,
+    6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469,
+    6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469, 6469,
+    6469, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 6468, 65535, 65535, 65535, 6467, 65535,
+    6466, 6465, 6465, 65535, 65535, 65535, 6464, 65535, 6463, 6462, 6462, 65535, 6461, 6460, 6460,
+    6459, 6459, 6459, 6459, 65535, 65535, 65535, 6458, 65535, 6457, 6456, 6456, 65535, 6455, 6454,
+    6454, 6453, 6453, 6453, 6453, 65535, 6452, 6451, 6451, 6450, 6450, 6450, 6450, 6449, 6449, 6449,
+    6449, 6449, 6449, 6449, 6449, 65535, 65535, 65535, 6448, 65535, 6447, 6446, 6446, 65535, 6445,
+    6444, 6444, 6443, 6443, 6443, 6443, 65535, 6442, 6441, 6441, 6440, 6440, 6440, 6440, 6439, 6439,
+    6439, 6439, 6439, 6439, 6439, 6439, 65535, 6438, 6437, 6437, 6436, 6436, 6436, 6436, 6435, 6435,
+    6435, 6435, 6435, 6435, 6435, 6435, 6434, 6434, 6434, 6434, 6434, 6434, 6434, 6434, 6434, 6434,
+    6434, 6434, 6434, 6434, 6434, 6434, 65535, 65535, 65535, 6433, 65535, 6432, 6431, 6431, 65535,
+    6430, 6429, 6429, 6428, 6428, 6428, 6428, 65535, 6427, 6426, 6426, 6425, 6425, 6425, 6425, 6424,
+    6424, 6424, 6424, 6424, 6424, 6424, 6424, 65535, 6423, 6422, 6422, 6421, 6421, 6421, 6421, 6420,
+    6420, 6420, 6420, 6420, 6420, 6420, 6420, 6419, 6419, 6419, 6419, 6419, 6419, 6419, 6419, 6419,
+    6419, 6419, 6419, 6419, 6419, 6419, 6419, 65535, 6418, 6417, 6417, 6416, 6416, 6416, 6416, 6415,
+    6415, 6415, 6415, 6415, 6415, 6415, 6415, 6414, 6414, 6414, 6414, 6414, 6414, 6414, 6414, 6414,
+    6414, 6414, 6414, 6414, 6414, 6414, 6414, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413,
+    6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413, 6413,
+    6413, 6413, 6413, 6413, 6413, 6413, 6413, 65535, 65535, 65535, 6412, 65535, 6411, 6410, 6410,
+    65535, 6409, 6408, 6408, 6407, 6407, 6407, 6407, 65535, 6406, 6405, 6405, 6404, 6404, 6404,
+    6404, 6403, 6403, 6403, 6403, 6403, 6403, 6403, 6403, 65535, 6402, 6401, 6401, 6400, 6400, 6400,
+    6400, 6399, 6399, 6399, 6399, 6399, 6399, 6399, 6399, 6398, 6398, 6398, 6398, 6398, 6398, 6398,
+    6398, 6398, 6398, 6398, 6398, 6398, 6398, 6398, 6398, 65535, 6397, 6396, 6396, 6395, 6395, 6395,
+    6395, 6394, 6394, 6394, 6394, 6394, 6394, 6394, 6394, 6393, 6393, 6393, 6393, 6393, 6393, 6393,
+    6393, 6393, 6393, 6393, 6393, 6393, 6393, 6393, 6393, 6392, 6392, 6392, 6392, 6392, 6392, 6392,
+    6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392,
+    6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 6392, 65535, 6391, 6390, 6390, 6389, 6389, 6389,
+    6389, 6388, 6388, 6388, 6388, 6388, 6388, 6388, 6388, 6387, 6387, 6387, 6387, 6387, 6387, 6387,
+    6387, 6387, 6387, 6387, 6387, 6387, 6387, 6387, 6387, 6386, 6386, 6386, 6386, 6386, 6386, 6386,
+    6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386,
+    6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6386, 6385, 6385, 6385, 6385, 6385, 6385, 6385,
+    6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385,
+    6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385,
+    6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385,
+    6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 6385, 65535, 65535, 65535, 6384, 65535, 6383,
+    6382, 6382, 65535, 6381, 6380, 6380, 6379, 6379, 6379, 6379, 65535, 6378, 6377, 6377, 6376,
+    6376, 6376, 6376, 6375, 6375, 6375, 6375, 6375, 6375, 6375, 6375, 65535, 6374, 6373, 6373, 6372,
+    6372, 6372, 6372, 6371, 6371, 6371, 6371, 6371, 6371, 6371, 6371, 6370, 6370, 6370, 6370, 6370,
+    6370, 6370, 6370, 6370, 6370, 6370, 6370, 6370, 6370, 6370, 6370, 65535, 6369, 6368, 6368, 6367,
+    6367, 6367, 6367, 6366, 6366, 6366, 6366, 6366, 6366, 6366, 6366, 6365, 6365, 6365, 6365, 6365,
+    6365, 6365, 6365, 6365, 6365, 6365, 6365, 6365, 6365, 6365, 6365, 6364, 6364, 6364, 6364, 6364,
+    6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364,
+    6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 6364, 65535, 6363, 6362, 6362, 6361,
+    6361, 6361, 6361, 6360, 6360, 6360, 6360, 6360, 6360, 6360, 6360, 6359, 6359, 6359, 6359, 6359,
+    6359, 6359, 6359, 6359, 6359, 6359, 6359, 6359, 6359, 6359, 6359, 6358, 6358, 6358, 6358, 6358,
+    6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358,
+    6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6358, 6357, 6357, 6357, 6357, 6357,
+    6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357,
+    6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357,
+    6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357,
+    6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 6357, 65535, 6356, 6355, 6355, 6354,
+    6354, 6354, 6354, 6353, 6353, 6353, 6353, 6353, 6353, 6353, 6353, 6352, 6352, 6352, 6352, 6352,
+    6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6351, 6351, 6351, 6351, 6351,
+    6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351,
+    6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6351, 6350, 6350, 6350, 6350, 6350,
+    6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350,
+    6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350,
+    6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350,
+    6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6350, 6349, 6349, 6349, 6349, 6349,
+    6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349,
+    6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349,
+    6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349,
+    6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349,
+    6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349,
+    6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349,
+    6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349,
+    6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 6349, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 6348, 65535, 65535, 65535, 6347, 65535, 6346, 6345, 6345, 65535, 65535,
+    65535, 6344, 65535, 6343, 6342, 6342, 65535, 6341, 6340, 6340, 6339, 6339, 6339, 6339, 65535,
+    65535, 65535, 6338, 65535, 6337, 6336, 6336, 65535, 6335, 6334, 6334, 6333, 6333, 6333, 6333,
+    65535, 6332, 6331, 6331, 6330, 6330, 6330, 6330, 6329, 6329, 6329, 6329, 6329, 6329, 6329, 6329,
+    65535, 65535, 65535, 6328, 65535, 6327, 6326, 6326, 65535, 6325, 6324, 6324, 6323, 6323, 6323,
+    6323, 65535, 6322, 6321, 6321, 6320, 6320, 6320, 6320, 6319, 6319, 6319, 6319, 6319, 6319, 6319,
+    6319, 65535, 6318, 6317, 6317, 6316, 6316, 6316, 6316, 6315, 6315, 6315, 6315, 6315, 6315, 6315,
+    6315, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314, 6314,
+    6314, 65535, 65535, 65535, 6313, 65535, 6312, 6311, 6311, 65535, 6310, 6309, 6309, 6308, 6308,
+    6308, 6308, 65535, 6307, 6306, 6306, 6305, 6305, 6305, 6305, 6304, 6304, 6304, 6304, 6304, 6304,
+    6304, 6304, 65535, 6303, 6302, 6302, 6301, 6301, 6301, 6301, 6300, 6300, 6300, 6300, 6300, 6300,
+    6300, 6300, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299, 6299,
+    6299, 6299, 65535, 6298, 6297, 6297, 6296, 6296, 6296, 6296, 6295, 6295, 6295, 6295, 6295, 6295,
+    6295, 6295, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294, 6294,
+    6294, 6294, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
+    6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293, 6293,
+    6293, 6293, 65535, 65535, 65535, 6292, 65535, 6291, 6290, 6290, 65535, 6289, 6288, 6288, 6287,
+    6287, 6287, 6287, 65535, 6286, 6285, 6285, 6284, 6284, 6284, 6284, 6283, 6283, 6283, 6283, 6283,
+    6283, 6283, 6283, 65535, 6282, 6281, 6281, 6280, 6280, 6280, 6280, 6279, 6279, 6279, 6279, 6279,
+    6279, 6279, 6279, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278, 6278,
+    6278, 6278, 6278, 65535, 6277, 6276, 6276, 6275, 6275, 6275, 6275, 6274, 6274, 6274, 6274, 6274,
+    6274, 6274, 6274, 6273, 6273, 6273, 6273, 6273, 6273, 6273, 6273, 6273, 6273, 6273, 6273, 6273,
+    6273, 6273, 6273, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272,
+    6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272,
+    6272, 6272, 6272, 65535, 6271, 6270, 6270, 6269, 6269, 6269, 6269, 6268, 6268, 6268, 6268, 6268,
+    6268, 6268, 6268, 6267, 6267, 6267, 6267, 6267, 6267, 6267, 6267, 6267, 6267, 6267, 6267, 6267,
+    6267, 6267, 6267, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266,
+    6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266, 6266,
+    6266, 6266, 6266, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265,
+    6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265,
+    6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265,
+    6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265, 6265,
+    6265, 6265, 6265, 65535, 65535, 65535, 6264, 65535, 6263, 6262, 6262, 65535, 6261, 6260, 6260,
+    6259, 6259, 6259, 6259, 65535, 6258, 6257, 6257, 6256, 6256, 6256, 6256, 6255, 6255, 6255, 6255,
+    6255, 6255, 6255, 6255, 65535, 6254, 6253, 6253, 6252, 6252, 6252, 6252, 6251, 6251, 6251, 6251,
+    6251, 6251, 6251, 6251, 6250, 6250, 6250, 6250, 6250, 6250, 6250, 6250, 6250, 6250, 6250, 6250,
+    6250, 6250, 6250, 6250, 65535, 6249, 6248, 6248, 6247, 6247, 6247, 6247, 6246, 6246, 6246, 6246,
+    6246, 6246, 6246, 6246, 6245, 6245, 6245, 6245, 6245, 6245, 6245, 6245, 6245, 6245, 6245, 6245,
+    6245, 6245, 6245, 6245, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244,
+    6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244, 6244,
+    6244, 6244, 6244, 6244, 65535, 6243, 6242, 6242, 6241, 6241, 6241, 6241, 6240, 6240, 6240, 6240,
+    6240, 6240, 6240, 6240, 6239, 6239, 6239, 6239, 6239, 6239, 6239, 6239, 6239, 6239, 6239, 6239,
+    6239, 6239, 6239, 6239, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238,
+    6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238, 6238,
+    6238, 6238, 6238, 6238, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237,
+    6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237,
+    6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237,
+    6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237, 6237,
+    6237, 6237, 6237, 6237, 65535, 6236, 6235, 6235, 6234, 6234, 6234, 6234, 6233, 6233, 6233, 6233,
+    6233, 6233, 6233, 6233, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6232,
+    6232, 6232, 6232, 6232, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231,
+    6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231, 6231,
+    6231, 6231, 6231, 6231, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230,
+    6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230,
+    6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230,
+    6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230, 6230,
+    6230, 6230, 6230, 6230, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+    6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+    6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+    6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+    6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+    6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+    6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+    6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229, 6229,
+    6229, 6229, 6229, 6229, 65535, 65535, 65535, 6228, 65535, 6227, 6226, 6226, 65535, 6225, 6224,
+    6224, 6223, 6223, 6223, 6223, 65535, 6222, 6221, 6221, 6220, 6220, 6220, 6220, 6219, 6219, 6219,
+    6219, 6219, 6219, 6219, 6219, 65535, 6218, 6217, 6217, 6216, 6216, 6216, 6216, 6215, 6215, 6215,
+    6215, 6215, 6215, 6215, 6215, 6214, 6214, 6214, 6214, 6214, 6214, 6214, 6214, 6214, 6214, 6214,
+    6214, 6214, 6214, 6214, 6214, 65535, 6213, 6212, 6212, 6211, 6211, 6211, 6211, 6210, 6210, 6210,
+    6210, 6210, 6210, 6210, 6210, 6209, 6209, 6209, 6209, 6209, 6209, 6209, 6209, 6209, 6209, 6209,
+    6209, 6209, 6209, 6209, 6209, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208,
+    6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208,
+    6208, 6208, 6208, 6208, 6208, 65535, 6207, 6206, 6206, 6205, 6205, 6205, 6205, 6204, 6204, 6204,
+    6204, 6204, 6204, 6204, 6204, 6203, 6203, 6203, 6203, 6203, 6203, 6203, 6203, 6203, 6203, 6203,
+    6203, 6203, 6203, 6203, 6203, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202,
+    6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202, 6202,
+    6202, 6202, 6202, 6202, 6202, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201,
+    6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201,
+    6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201,
+    6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201, 6201,
+    6201, 6201, 6201, 6201, 6201, 65535, 6200, 6199, 6199, 6198, 6198, 6198, 6198, 6197, 6197, 6197,
+    6197, 6197, 6197, 6197, 6197, 6196, 6196, 6196, 6196, 6196, 6196, 6196, 6196, 6196, 6196, 6196,
+    6196, 6196, 6196, 6196, 6196, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195,
+    6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195, 6195,
+    6195, 6195, 6195, 6195, 6195, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194,
+    6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194,
+    6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194,
+    6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194, 6194,
+    6194, 6194, 6194, 6194, 6194, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193,
+    6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193,
+    6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193,
+    6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193,
+    6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193,
+    6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193,
+    6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193,
+    6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193, 6193,
+    6193, 6193, 6193, 6193, 6193, 65535, 6192, 6191, 6191, 6190, 6190, 6190, 6190, 6189, 6189, 6189,
+    6189, 6189, 6189, 6189, 6189, 6188, 6188, 6188, 6188, 6188, 6188, 6188, 6188, 6188, 6188, 6188,
+    6188, 6188, 6188, 6188, 6188, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187,
+    6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187, 6187,
+    6187, 6187, 6187, 6187, 6187, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186,
+    6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186,
+    6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186,
+    6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186, 6186,
+    6186, 6186, 6186, 6186, 6186, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185,
+    6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185,
+    6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185,
+    6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185,
+    6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185,
+    6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185,
+    6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185,
+    6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185, 6185,
+    6185, 6185, 6185, 6185, 6185, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+};
+
+const uint8_t straight_rank_table[8192] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9,
+    9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9,
+    9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+};
+
+const uint64_t binomial_table[65][9] = {
+    {1, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 1, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 1, 0, 0, 0, 0, 0, 0},
+    {1, 3, 3, 1, 0, 0, 0, 0, 0},
+    {1, 4, 6, 4, 1, 0, 0, 0, 0},
+    {1, 5, 10, 10, 5, 1, 0, 0, 0},
+    {1, 6, 15, 20, 15, 6, 1, 0, 0},
+    {1, 7, 21, 35, 35, 21, 7, 1, 0},
+    {1, 8, 28, 56, 70, 56, 28, 8, 1},
+    {1, 9, 36, 84, 126, 126, 84, 36, 9},
+    {1, 10, 45, 120, 210, 252, 210, 120, 45},
+    {1, 11, 55, 165, 330, 462, 462, 330, 165},
+    {1, 12, 66, 220, 495, 792, 924, 792, 495},
+    {1, 13, 78, 286, 715, 1287, 1716, 1716, 1287},
+    {1, 14, 91, 364, 1001, 2002, 3003, 3432, 3003},
+    {1, 15, 105, 455, 1365, 3003, 5005, 6435, 6435},
+    {1, 16, 120, 560, 1820, 4368, 8008, 11440, 12870},
+    {1, 17, 136, 680, 2380, 6188, 12376, 19448, 24310},
+    {1, 18, 153, 816, 3060, 8568, 18564, 31824, 43758},
+    {1, 19, 171, 969, 3876, 11628, 27132, 50388, 75582},
+    {1, 20, 190, 1140, 4845, 15504, 38760, 77520, 125970},
+    {1, 21, 210, 1330, 5985, 20349, 54264, 116280, 203490},
+    {1, 22, 231, 1540, 7315, 26334, 74613, 170544, 319770},
+    {1, 23, 253, 1771, 8855, 33649, 100947, 245157, 490314},
+    {1, 24, 276, 2024, 10626, 42504, 134596, 346104, 735471},
+    {1, 25, 300, 2300, 12650, 53130, 177100, 480700, 1081575},
+    {1, 26, 325, 2600, 14950, 65780, 230230, 657800, 1562275},
+    {1, 27, 351, 2925, 17550, 80730, 296010, 888030, 2220075},
+    {1, 28, 378, 3276, 20475, 98280, 376740, 1184040, 3108105},
+    {1, 29, 406, 3654, 23751, 118755, 475020, 1560780, 4292145},
+    {1, 30, 435, 4060, 27405, 142506, 593775, 2035800, 5852925},
+    {1, 31, 465, 4495, 31465, 169911, 736281, 2629575, 7888725},
+    {1, 32, 496, 4960, 35960, 201376, 906192, 3365856, 10518300},
+    {1, 33, 528, 5456, 40920, 237336, 1107568, 4272048, 13884156},
+    {1, 34, 561, 5984, 46376, 278256, 1344904, 5379616, 18156204},
+    {1, 35, 595, 6545, 52360, 324632, 1623160, 6724520, 23535820},
+    {1, 36, 630, 7140, 58905, 376992, 1947792, 8347680, 30260340},
+    {1, 37, 666, 7770, 66045, 435897, 2324784, 10295472, 38608020},
+    {1, 38, 703, 8436, 73815, 501942, 2760681, 12620256, 48903492},
+    {1, 39, 741, 9139, 82251, 575757, 3262623, 15380937, 61523748},
+    {1, 40, 780, 9880, 91390, 658008, 3838380, 18643560, 76904685},
+    {1, 41, 820, 10660, 101270, 749398, 4496388, 22481940, 95548245},
+    {1, 42, 861, 11480, 111930, 850668, 5245786, 26978328, 118030185},
+    {1, 43, 903, 12341, 123410, 962598, 6096454, 32224114, 145008513},
+    {1, 44, 946, 13244, 135751, 1086008, 7059052, 38320568, 177232627},
+    {1, 45, 990, 14190, 148995, 1221759, 8145060, 45379620, 215553195},
+    {1, 46, 1035, 15180, 163185, 1370754, 9366819, 53524680, 260932815},
+    {1, 47, 1081, 16215, 178365, 1533939, 10737573, 62891499, 314457495},
+    {1, 48, 1128, 17296, 194580, 1712304, 12271512, 73629072, 377348994},
+    {1, 49, 1176, 18424, 211876, 1906884, 13983816, 85900584, 450978066},
+    {1, 50, 1225, 19600, 230300, 2118760, 15890700, 99884400, 536878650},
+    {1, 51, 1275, 20825, 249900, 2349060, 18009460, 115775100, 636763050},
+    {1, 52, 1326, 22100, 270725, 2598960, 20358520, 133784560, 752538150},
+    {1, 53, 1378, 23426, 292825, 2869685, 22957480, 154143080, 886322710},
+    {1, 54, 1431, 24804, 316251, 3162510, 25827165, 177100560, 1040465790},
+    {1, 55, 1485, 26235, 341055, 3478761, 28989675, 202927725, 1217566350},
+    {1, 56, 1540, 27720, 367290, 3819816, 32468436, 231917400, 1420494075},
+    {1, 57, 1596, 29260, 395010, 4187106, 36288252, 264385836, 1652411475},
+    {1, 58, 1653, 30856, 424270, 4582116, 40475358, 300674088, 1916797311},
+    {1, 59, 1711, 32509, 455126, 5006386, 45057474, 341149446, 2217471399},
+    {1, 60, 1770, 34220, 487635, 5461512, 50063860, 386206920, 2558620845},
+    {1, 61, 1830, 35990, 521855, 5949147, 55525372, 436270780, 2944827765},
+    {1, 62, 1891, 37820, 557845, 6471002, 61474519, 491796152, 3381098545},
+    {1, 63, 1953, 39711, 595665, 7028847, 67945521, 553270671, 3872894697},
+    {1, 64, 2016, 41664, 635376, 7624512, 74974368, 621216192, 4426165368},
+};
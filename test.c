@@ -1,4 +1,15 @@
-#include "eval.c"
+#include "batch_eval.c"
+#include "board_eval.c"
+#include "canonical.c"
+#include "combination.c"
+#include "engine.c"
+#include "equity.c"
+#include "flop_table.c"
+#include "montecarlo.c"
+#include "omaha.c"
+#include "server.c"
+#include "shard.c"
+#include "solver.c"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,12 +35,13 @@
                 if (!(x)) {                                                                        \
                         printf("[%s:%d]: Expected '%s' to be true, was false.\n", __FILE__,        \
                                __LINE__, #x);                                                      \
+                        return -1;                                                                 \
                 }                                                                                  \
         } while (0)
 
-int test_suite(const char *filename) {
+int test_suite(const char *filename, uint32_t (*eval)(Card)) {
         FILE *file;
-        char *line;
+        char *line = NULL;
         size_t len = 0;
         ssize_t read;
 
@@ -37,19 +49,13 @@ int test_suite(const char *filename) {
 
         uint32_t count = 0;
         while ((read = getline(&line, &len, file)) != -1) {
-                // printf("count: %d\n", count);
-
                 for (int j = 2; j < 15; j += 3) {
                         line[j] = '\0';
                 }
 
-                for (int j = 0; j < 13; j += 3) {
-                        printf("%s ", &line[j]);
-                }
-                printf("\n");
-
-                ASSERT_EQ2(eval_hand_strings(line, line + 3, line + 6, line + 9, line + 12, "", ""),
-                           count);
+                Card hand = create_card(line) | create_card(line + 3) | create_card(line + 6) |
+                            create_card(line + 9) | create_card(line + 12);
+                ASSERT_EQ2(eval(hand), count);
 
                 count += 1;
         }
@@ -65,7 +71,26 @@ int test_suite(const char *filename) {
 int test() {
         printf("Running Tests...\n");
 
-        init_high_cards();
+        {
+                printf("Testing generated tables\n");
+
+                // tables.h still holds what its generator computes, so it isn't stale
+                struct RankTables *t = malloc(sizeof(struct RankTables));
+                compute_rank_tables(t);
+                ASSERT(memcmp(t->unique_fives, unique_five_lookup_table, sizeof(t->unique_fives)) ==
+                       0);
+                ASSERT(memcmp(t->top_fives, top_five_table, sizeof(t->top_fives)) == 0);
+                ASSERT(memcmp(t->flush_ranks, flush_rank_table, sizeof(t->flush_ranks)) == 0);
+                ASSERT(memcmp(t->high_card_ranks, high_card_rank_table,
+                              sizeof(t->high_card_ranks)) == 0);
+                ASSERT(memcmp(t->straight_ranks, straight_rank_table, sizeof(t->straight_ranks)) ==
+                       0);
+                free(t);
+
+                uint64_t binomials[MAX_COMBINATION_BITS + 1][MAX_COMBINATION_SIZE + 1];
+                compute_binomials(binomials);
+                ASSERT(memcmp(binomials, binomial_table, sizeof(binomials)) == 0);
+        }
 
         {
                 printf("Testing Card Creation\n");
@@ -88,6 +113,11 @@ int test() {
                 ASSERT_EQ(straight_rank(0x0F80), 13); // King
                 ASSERT_EQ(straight_rank(0x07C0), 12); // Queen
                 ASSERT_EQ(straight_rank(0x100F), 5);  // Wheel
+                ASSERT_EQ(straight_rank(0x1E07), 0);
+
+                ASSERT_EQ(top_five_table[0x1FFF], 0x1F00);
+                ASSERT_EQ(top_five_table[0x0107], 0x0107);
+                ASSERT_EQ(top_five_table[0x1A35], 0x1A30);
         }
 
         {
@@ -172,6 +202,10 @@ int test() {
         {
                 printf("Testing Evaluation Function\n");
 
+                // Two sets of trips make a full house with the lower set as the pair
+                ASSERT_EQ(eval_hand_strings("Ad", "Ah", "Ac", "Kd", "Ks", "Kc", "Qs"),
+                          eval_hand_strings("Ad", "Ah", "Ac", "Kd", "Ks", "", ""));
+
                 // Two royal flushes should have equal values
                 ASSERT_EQ(eval_hand_strings("Ac", "Kc", "Qc", "Jc", "Tc", "Ad", "As"),
                           eval_hand_strings("Ah", "Kh", "Qh", "Jh", "Th", "Ad", "As"));
@@ -180,10 +214,692 @@ int test() {
         {
                 printf("Testing vs. 5-card suite\n");
 
-                ASSERT_EQ(test_suite("test-suite-1.txt"), 0);
-                ASSERT_EQ(test_suite("test-suite-2.txt"), 0);
-                ASSERT_EQ(test_suite("test-suite-3.txt"), 0);
-                ASSERT_EQ(test_suite("test-suite-4.txt"), 0);
+                ASSERT_EQ(test_suite("test-suite-1.txt", eval_hand), 0);
+                ASSERT_EQ(test_suite("test-suite-2.txt", eval_hand), 0);
+                ASSERT_EQ(test_suite("test-suite-3.txt", eval_hand), 0);
+                ASSERT_EQ(test_suite("test-suite-4.txt", eval_hand), 0);
+        }
+
+        {
+                printf("Testing Hash Evaluator\n");
+
+                ASSERT(init_engine(ENGINE_HASH));
+                ASSERT_EQ(parse_engine("hash"), ENGINE_HASH);
+                ASSERT_EQ(parse_engine("nope"), NUM_ENGINES);
+
+                ASSERT_EQ(test_suite("test-suite-1.txt", eval_hand_hash), 0);
+                ASSERT_EQ(test_suite("test-suite-2.txt", eval_hand_hash), 0);
+                ASSERT_EQ(test_suite("test-suite-3.txt", eval_hand_hash), 0);
+                ASSERT_EQ(test_suite("test-suite-4.txt", eval_hand_hash), 0);
+
+                // Random 6- and 7-card hands agree with the branchy evaluator
+                uint64_t state = 0x853C49E6748FEA9BULL;
+                for (int i = 0; i < 1000000; i += 1) {
+                        Card hand = 0;
+                        uint32_t cards = 6 + i % 2;
+                        while (count_bits(hand & 0x1FFF) + count_bits((hand >> 16) & 0x1FFF) +
+                                   count_bits((hand >> 32) & 0x1FFF) +
+                                   count_bits((hand >> 48) & 0x1FFF) <
+                               cards) {
+                                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                                uint32_t index = (state >> 33) % 52;
+                                hand |= 1ull << (16 * (index / 13) + index % 13);
+                        }
+
+                        ASSERT_EQ(eval_hand_hash(hand), eval_hand(hand));
+                }
+        }
+
+        {
+                printf("Testing Batch Evaluation\n");
+
+                // Odd length, so every kernel also runs its scalar tail
+                const size_t n = 100003;
+                uint64_t *hands = malloc(n * sizeof(uint64_t));
+                uint32_t *scores = malloc(n * sizeof(uint32_t));
+                uint64_t state = 0xDA3E39CB94B95BDBULL;
+                for (size_t i = 0; i < n; i += 1) {
+                        Card hand = 0;
+                        for (uint32_t cards = 0; cards < 7;) {
+                                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                                uint32_t index = (state >> 33) % 52;
+                                Card card = 1ull << (16 * (index / 13) + index % 13);
+                                if (!(hand & card)) {
+                                        hand |= card;
+                                        cards += 1;
+                                }
+                        }
+                        hands[i] = hand;
+                }
+
+                __builtin_cpu_init();
+                void (*kernels[3])(const uint64_t *, uint32_t *, size_t) = {
+                    eval_hand_batch_scalar,
+                    __builtin_cpu_supports("avx2") ? eval_hand_batch_avx2 : NULL,
+                    __builtin_cpu_supports("avx512f") ? eval_hand_batch_avx512 : NULL,
+                };
+                for (int k = 0; k < 3; k += 1) {
+                        if (!kernels[k]) {
+                                continue;
+                        }
+
+                        memset(scores, 0xFF, n * sizeof(uint32_t));
+                        kernels[k](hands, scores, n);
+                        for (size_t i = 0; i < n; i += 1) {
+                                ASSERT_EQ(scores[i], eval_hand(hands[i]));
+                        }
+                }
+
+                eval_hand_batch(hands, scores, n);
+                ASSERT_EQ(scores[n - 1], eval_hand(hands[n - 1]));
+
+                free(hands);
+                free(scores);
+        }
+
+        {
+                printf("Testing Board-Conditioned Evaluation\n");
+
+                // Every hole pair on a spread of boards, including ones with a three- and
+                // four-flush and paired boards
+                const char *boards[][5] = {
+                    {"Ah", "Kh", "Qh", "2c", "7d"}, {"Ah", "Kh", "Qh", "Jh", "7d"},
+                    {"9s", "8s", "7s", "6s", "5s"}, {"Ad", "Ah", "Ac", "Kd", "Ks"},
+                    {"2c", "3d", "4h", "5s", "9c"}, {"Tc", "Td", "4h", "4s", "9c"},
+                };
+                for (int b = 0; b < sizeof(boards) / sizeof(boards[0]); b += 1) {
+                        Card board = 0;
+                        for (int i = 0; i < 5; i += 1) {
+                                board |= create_card(boards[b][i]);
+                        }
+
+                        struct BoardState state;
+                        board_eval_init(&state, board);
+                        for (int i = 0; i < 64; i += 1) {
+                                for (int j = i + 1; j < 64; j += 1) {
+                                        Card hole = (1ull << i) | (1ull << j);
+                                        if ((hole & board) || (hole & 0xE000E000E000E000)) {
+                                                continue;
+                                        }
+
+                                        ASSERT_EQ(board_eval_finish(&state, hole),
+                                                  eval_hand(board | hole));
+                                }
+                        }
+                }
+        }
+
+        {
+                printf("Testing Five- and Six-Card Evaluation\n");
+
+                ASSERT_EQ(test_suite("test-suite-1.txt", eval_five), 0);
+                ASSERT_EQ(test_suite("test-suite-3.txt", eval_five), 0);
+
+                Card deck[52];
+                for (int i = 0; i < 52; i += 1) {
+                        deck[i] = 1ull << (16 * (i / 13) + i % 13);
+                }
+                for (int a = 0; a < 52; a += 1) {
+                        for (int b = a + 1; b < 52; b += 1) {
+                                for (int c = b + 1; c < 52; c += 1) {
+                                        for (int d = c + 1; d < 52; d += 1) {
+                                                Card four = deck[a] | deck[b] | deck[c] | deck[d];
+                                                for (int e = d + 1; e < 52; e += 1) {
+                                                        ASSERT_EQ(eval_five(four | deck[e]),
+                                                                  eval_hand(four | deck[e]));
+                                                }
+                                        }
+                                }
+                        }
+                }
+
+                struct CombinationIterator sixes;
+                combinations_start(&sixes, 6, FULL_DECK, 0);
+                uint64_t num_sixes = 0;
+                do {
+                        ASSERT_EQ(eval_six(sixes.cards), eval_hand(sixes.cards));
+                        num_sixes += 1;
+                } while (combinations_next(&sixes));
+                ASSERT_EQ(num_sixes, 20358520);
+                Card six = create_card("Ah") | create_card("Kh") | create_card("Qd") |
+                           create_card("Qc") | create_card("9h") | create_card("2s");
+                ASSERT_EQ(eval_cards(six), eval_hand(six));
+                ASSERT_EQ(eval_hand_strings("7h", "5h", "4c", "3d", "2d", "8c", ""),
+                          eval_hand_strings("7h", "5h", "4c", "3d", "8c", "", ""));
+        }
+
+        {
+                printf("Testing Omaha Evaluation\n");
+
+                // The steel wheel on board needs three hearts from the hand, so only aces count
+                Card hole = create_card("Ah") | create_card("As") | create_card("Kd") |
+                            create_card("Kc");
+                Card board = create_card("2h") | create_card("3h") | create_card("4h") |
+                             create_card("5h") | create_card("9c");
+                Card aces = create_card("Ah") | create_card("As") | create_card("9c") |
+                            create_card("5h") | create_card("4h");
+                ASSERT_EQ(eval_omaha(hole, board), eval_five(aces));
+
+                // Against the best of every two hole and three board cards
+                uint64_t state = 0x2545F4914F6CDD1DULL;
+                for (int i = 0; i < 20000; i += 1) {
+                        Card cards[9];
+                        Card dealt = 0;
+                        for (int k = 0; k < 9;) {
+                                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                                uint32_t index = (state >> 33) % 52;
+                                Card card = 1ull << (16 * (index / 13) + index % 13);
+                                if (!(dealt & card)) {
+                                        dealt |= card;
+                                        cards[k++] = card;
+                                }
+                        }
+
+                        // Flops and turns too, from the first three or four board cards
+                        uint32_t board_cards = 3 + i % 3;
+                        hole = cards[0] | cards[1] | cards[2] | cards[3];
+                        board = 0;
+                        for (uint32_t k = 0; k < board_cards; k += 1) {
+                                board |= cards[4 + k];
+                        }
+
+                        uint32_t best = UINT32_MAX;
+                        for (int a = 0; a < 4; a += 1) {
+                                for (int b = a + 1; b < 4; b += 1) {
+                                        for (int c = 4; c < 4 + board_cards; c += 1) {
+                                                for (int d = c + 1; d < 4 + board_cards; d += 1) {
+                                                        for (int e = d + 1; e < 4 + board_cards;
+                                                             e += 1) {
+                                                                uint32_t score = eval_hand(
+                                                                    cards[a] | cards[b] |
+                                                                    cards[c] | cards[d] | cards[e]);
+                                                                best = score < best ? score : best;
+                                                        }
+                                                }
+                                        }
+                                }
+                        }
+                        ASSERT_EQ(eval_omaha(hole, board), best);
+                }
+        }
+
+        {
+                printf("Testing Combination Indexing\n");
+
+                ASSERT_EQ(binomial_table[50][5], 2118760);
+                ASSERT_EQ(binomial_table[45][2], 990);
+
+                // Seeking to the i-th board agrees with stepping there from the first one, and
+                // the dense iterator visits the same boards as next_combination
+                const uint64_t deadzones = 0xE000E000E000E000;
+                uint64_t hand = create_card("Ah") | create_card("Kd");
+                uint64_t deck = FULL_DECK ^ hand;
+                uint64_t board = nth_combination(0, 5, deck);
+                struct CombinationIterator boards;
+                combinations_start(&boards, 5, deck, 0);
+                for (uint64_t i = 0; i < binomial_table[50][5]; i += 1) {
+                        ASSERT_EQ(boards.cards, board);
+                        if (i % 997 == 0) {
+                                struct CombinationIterator seeked;
+                                combinations_start(&seeked, 5, deck, i);
+                                ASSERT_EQ(seeked.cards, board);
+                                ASSERT_EQ(nth_combination(i, 5, deck), board);
+                                ASSERT_EQ(combination_index(board, deck), i);
+                        }
+                        if (i != binomial_table[50][5] - 1) {
+                                board = next_combination(board, deadzones | hand);
+                                ASSERT(combinations_next(&boards));
+                        }
+                }
+                ASSERT_EQ(board, 0x1F00000000000000); // AKQJT of clubs
+                ASSERT(!combinations_next(&boards));
+                ASSERT_EQ(boards.cards, board);
+
+                ASSERT_EQ(card_pext(board, deck), 0x3E00000000000ull);
+                ASSERT_EQ(card_pdep(0x3E00000000000ull, deck), board);
+        }
+
+        {
+                printf("Testing instruction set dispatch\n");
+
+                ASSERT_EQ(parse_isa("x86-64-v3"), ISA_X86_64_V3);
+                ASSERT_EQ(parse_isa("avx9"), NUM_ISAS);
+                ASSERT(isa_supported(ISA_X86_64));
+                ASSERT(isa_supported(init_isa()));
+
+                // Every level the CPU runs gives the same results as the default code
+                Card hole = create_card("Qh") | create_card("Jh");
+                Card board = create_card("Th") | create_card("9h") | create_card("2c") |
+                             create_card("2d") | create_card("Ks");
+                Card live = FULL_DECK ^ hole ^ board;
+                struct BoardState state;
+                board_eval_init(&state, board);
+                uint32_t player_score = board_eval_finish(&state, hole);
+                struct DealerCounts expected = {0, 0, 0};
+                struct CombinationIterator dealers;
+                combinations_start(&dealers, 2, live, 0);
+                do {
+                        uint32_t dealer_score = eval_hand(board | dealers.cards);
+                        expected.wins_qualified +=
+                            player_score < dealer_score && dealer_score < HIGH_CARD_INDEX;
+                        expected.wins_unqualified +=
+                            player_score < dealer_score && dealer_score >= HIGH_CARD_INDEX;
+                        expected.losses += player_score > dealer_score;
+                } while (combinations_next(&dealers));
+
+                Card boards[100];
+                for (int isa = 0; isa < NUM_ISAS; isa += 1) {
+                        if (!isa_supported(isa)) {
+                                continue;
+                        }
+
+                        const struct Kernels *k = &KERNELS[isa];
+                        struct DealerCounts counts = k->score_dealers(&state, live, player_score);
+                        ASSERT_EQ(counts.wins_qualified, expected.wins_qualified);
+                        ASSERT_EQ(counts.wins_unqualified, expected.wins_unqualified);
+                        ASSERT_EQ(counts.losses, expected.losses);
+
+                        k->enumerate_combinations(5, live, 1000, boards, 100);
+                        for (uint32_t i = 0; i < 100; i += 1) {
+                                ASSERT_EQ(boards[i], nth_combination(1000 + i, 5, live));
+                                ASSERT_EQ(k->nth_combination(1000 + i, 5, live), boards[i]);
+                                ASSERT_EQ(k->combination_index(boards[i], live), 1000 + i);
+                                Card hand = boards[i] | hole;
+                                ASSERT_EQ(k->eval_hand(hand), eval_hand(hand));
+                                ASSERT_EQ(k->eval_hand_hash(hand), eval_hand(hand));
+                        }
+                }
+        }
+
+        {
+                printf("Testing Suit Canonicalization\n");
+
+                struct SuitSymmetry symmetry;
+                init_suit_symmetry(&symmetry, create_card("Ah") | create_card("Kd"));
+                ASSERT_EQ(symmetry.count, 2);
+                init_suit_symmetry(&symmetry, create_card("Ah") | create_card("Ad"));
+                ASSERT_EQ(symmetry.count, 4);
+
+                uint64_t hand = create_card("Ah") | create_card("Kh");
+                init_suit_symmetry(&symmetry, hand);
+                ASSERT_EQ(symmetry.count, 6);
+
+                // Permuted boards share a canonical board and score the same
+                Card board = create_card("2c") | create_card("7c") | create_card("Qs") |
+                             create_card("Jd") | create_card("3d");
+                Card permuted = create_card("2s") | create_card("7s") | create_card("Qd") |
+                                create_card("Jc") | create_card("3c");
+                uint32_t weight;
+                ASSERT_EQ(canonical_cards(&symmetry, board, &weight),
+                          canonical_cards(&symmetry, permuted, &weight));
+                ASSERT_EQ(eval_hand(board | hand), eval_hand(permuted | hand));
+
+                // Class sizes of the canonical boards add up to every board
+                const uint64_t deadzones = 0xE000E000E000E000;
+                uint64_t deck = 0x1FFF1FFF1FFF1FFF ^ hand;
+                uint64_t total = 0;
+                uint64_t classes = 0;
+                board = nth_combination(0, 5, deck);
+                for (uint64_t i = 0; i < binomial_table[50][5]; i += 1) {
+                        weight = canonical_weight(&symmetry, board);
+                        total += weight;
+                        classes += weight != 0;
+                        if (i != binomial_table[50][5] - 1) {
+                                board = next_combination(board, deadzones | hand);
+                        }
+                }
+                ASSERT_EQ(total, binomial_table[50][5]);
+                ASSERT(classes < binomial_table[50][5] / 5);
+        }
+
+        {
+                printf("Testing decision tree helpers\n");
+
+                Card hand = starting_hand_cards('A', 'K', false);
+                ASSERT_EQ(hand, (create_card("Ah") | create_card("Kd")));
+                char name[5];
+                format_cards(hand, name);
+                ASSERT(strcmp(name, "AhKd") == 0);
+
+                // Losing to every dealer hole costs 3 units a hand when calling, 2 when folding
+                int64_t value;
+                struct BoardOutcome outcome =
+                    board_outcome(0, 0, NUM_DEALER_HOLES, HIGH_CARD_INDEX);
+                ASSERT_EQ(river_decision(outcome, &value), ACTION_FOLD);
+                ASSERT_EQ(value, -2 * HALF_UNITS * NUM_DEALER_HOLES);
+
+                // Winning half the time loses 1 unit a hand when calling, so call
+                outcome = board_outcome(NUM_DEALER_HOLES / 2, 0, NUM_DEALER_HOLES / 2, PAIR_INDEX);
+                ASSERT_EQ(river_decision(outcome, &value), ACTION_BET_1X);
+                ASSERT_EQ(value, -HALF_UNITS * NUM_DEALER_HOLES / 2);
+
+                // The packed outcome holds a royal flush beating every hand, 3:2 blinds and
+                // unqualified dealers exactly
+                outcome = board_outcome(NUM_DEALER_HOLES, 0, 0, 0);
+                ASSERT_EQ(outcome_payout(outcome, 4), HALF_UNITS * NUM_DEALER_HOLES * 505);
+                outcome = board_outcome(100, 200, 300, FLUSH_INDEX);
+                ASSERT_EQ(outcome_payout(outcome, 2), 100 * 9 + 200 * 7 - 300 * 8);
+        }
+
+        {
+                printf("Testing table files\n");
+
+                // A payload that went bad on disk is only caught when checksums are verified
+                const char *path = "/tmp/utx-test-table.tbl";
+                uint64_t payload[4] = {1, 2, 3, 4};
+                ASSERT(write_table_file(path, "test", EVAL_VERSION, payload, sizeof(payload)));
+                FILE *file = fopen(path, "r+b");
+                ASSERT(file);
+                fseek(file, TABLE_FILE_HEADER_SIZE, SEEK_SET);
+                fputc(9, file);
+                fclose(file);
+
+                uint64_t size;
+                const uint64_t *mapped = map_table_file(path, "test", EVAL_VERSION, &size);
+                ASSERT(mapped);
+                ASSERT_EQ(size, sizeof(payload));
+                ASSERT_EQ(mapped[0], 9);
+                unmap_table_file(mapped, size);
+                ASSERT(!map_table_file(path, "other", EVAL_VERSION, &size));
+
+                verify_table_checksums = true;
+                ASSERT(!map_table_file(path, "test", EVAL_VERSION, &size));
+                verify_table_checksums = false;
+                unlink(path);
+        }
+
+        {
+                printf("Testing runout table cache\n");
+
+                const char *path = "/tmp/utx-test-runout.tbl";
+                struct Solution solution;
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                struct RunoutTable *table = calloc(1, sizeof(struct RunoutTable));
+                table->version = RUNOUT_TABLE_VERSION;
+                table->hand = solution.hand;
+                table->raise4_total = 12345;
+                table->chunks_done = NUM_RUNOUT_CHUNKS;
+                table->board_outcomes[NUM_BOARDS - 1] = board_outcome(3, 2, 1, FLUSH_INDEX);
+                solution.runout = table;
+                ASSERT(save_runout_table(&solution, path));
+                free_solution(&solution);
+
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                ASSERT(load_runout_table(&solution, path));
+                ASSERT_EQ(solution.runout->raise4_total, 12345);
+                ASSERT_EQ(outcome_payout(solution.runout->board_outcomes[NUM_BOARDS - 1], 1),
+                          3 * 7 + 2 * 5 - 6);
+                free_solution(&solution);
+
+                // A table saved for other hole cards is rejected
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', false)));
+                ASSERT(!load_runout_table(&solution, path));
+                free_solution(&solution);
+                unlink(path);
+        }
+
+        {
+                printf("Testing solver checkpoints\n");
+
+                const char *path = "/tmp/utx-test-checkpoint.tbl";
+                struct Solution solution;
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+
+                // An unfinished runout only saves its finished chunks, and isn't reused as a cache
+                struct RunoutTable *table = calloc(1, sizeof(struct RunoutTable));
+                table->version = RUNOUT_TABLE_VERSION;
+                table->hand = solution.hand;
+                table->chunks_done = 2;
+                table->board_outcomes[RUNOUT_CHUNK_SIZE] = board_outcome(3, 2, 1, FLUSH_INDEX);
+                ASSERT(write_runout_table(table, path));
+                ASSERT(!load_runout_table(&solution, path));
+                const struct RunoutTable *mapped = map_runout_table(path, solution.hand);
+                ASSERT(mapped);
+                ASSERT_EQ(mapped->chunks_done, 2);
+                ASSERT_EQ(mapped->board_outcomes[RUNOUT_CHUNK_SIZE].base,
+                          table->board_outcomes[RUNOUT_CHUNK_SIZE].base);
+                unmap_table_file(mapped, runout_table_size(2));
+                free(table);
+
+                // Resuming the flop sweep restarts at the flop it stopped on
+                solution.flop_nodes[7].bet_total = 99;
+                ASSERT(write_flop_checkpoint(&solution, 8, 1234, path));
+                solution.flop_nodes[7].bet_total = 0;
+                int64_t total = 0;
+                ASSERT_EQ(read_flop_checkpoint(&solution, path, &total), 8);
+                ASSERT_EQ(total, 1234);
+                ASSERT_EQ(solution.flop_nodes[7].bet_total, 99);
+                Card flop = 0x7;
+                for (uint32_t i = 0; i < 8; i += 1) {
+                        flop = next_combination(flop, 0xE000E000E000E000 | solution.hand);
+                }
+                ASSERT_EQ(nth_combination(8, 3, solution.deck), flop);
+                free_solution(&solution);
+
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', false)));
+                ASSERT_EQ(read_flop_checkpoint(&solution, path, &total), 0);
+                free_solution(&solution);
+                unlink(path);
+        }
+
+        {
+                printf("Testing shards\n");
+
+                uint32_t shard, num_shards;
+                ASSERT(parse_shard("2/8", &shard, &num_shards));
+                ASSERT_EQ(shard, 1);
+                ASSERT_EQ(num_shards, 8);
+                ASSERT(!parse_shard("0/8", &shard, &num_shards));
+                ASSERT(!parse_shard("9/8", &shard, &num_shards));
+                ASSERT(!parse_shard("1/", &shard, &num_shards));
+                ASSERT(!parse_shard("1/999", &shard, &num_shards));
+                ASSERT_EQ(shard_start(NUM_FLOPS, 0, 7), 0);
+                ASSERT_EQ(shard_start(NUM_FLOPS, 7, 7), NUM_FLOPS);
+                ASSERT_EQ(runout_shard_board(3, 3), NUM_BOARDS);
+
+                // Merging every shard's part of a runout table gives back the whole table
+                const char *paths[3] = {"/tmp/utx-test-shard-1.tbl", "/tmp/utx-test-shard-2.tbl",
+                                        "/tmp/utx-test-shard-3.tbl"};
+                struct Solution solution;
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                struct RunoutTable *table = calloc(1, sizeof(struct RunoutTable));
+                solution.runout = table;
+                for (uint32_t i = 0; i < 3; i += 1) {
+                        uint32_t first = runout_shard_board(i, 3);
+                        table->board_outcomes[first] = board_outcome(i + 1, 0, 0, FLUSH_INDEX);
+                        table->raise4_total = 1000 * (i + 1);
+                        table->canonical_boards = i + 1;
+                        ASSERT(save_runout_shard(&solution, i, 3, paths[i]));
+                }
+                free_solution(&solution);
+
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                ASSERT(merge_runout_shards(&solution, paths, 3));
+                ASSERT_EQ(solution.runout->raise4_total, 6000);
+                ASSERT_EQ(solution.runout->canonical_boards, 6);
+                ASSERT_EQ(solution.runout->chunks_done, NUM_RUNOUT_CHUNKS);
+                ASSERT_EQ(solution.runout->board_outcomes[runout_shard_board(2, 3)].net_wins, 3);
+                free_solution(&solution);
+
+                // Shards of another split, or another hand, are rejected
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                ASSERT(!merge_runout_shards(&solution, paths, 2));
+                free_solution(&solution);
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', false)));
+                ASSERT(!merge_runout_shards(&solution, paths, 3));
+                free_solution(&solution);
+
+                // The same goes for every shard's part of a flop sweep
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                memset(solution.flop_nodes, 0, NUM_FLOPS * sizeof(struct FlopNode));
+                for (uint32_t i = 0; i < 3; i += 1) {
+                        uint32_t first = shard_start(NUM_FLOPS, i, 3);
+                        solution.flop_nodes[first].bet_total = i + 1;
+                        solution.flop_nodes[first].action = ACTION_BET_2X;
+                        solution.check_total = 1000 * (i + 1);
+                        ASSERT(save_flop_shard(&solution, i, 3, paths[i]));
+                }
+                free_solution(&solution);
+
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                ASSERT(merge_flop_shards(&solution, paths, 3));
+                ASSERT_EQ(solution.check_total, 6000);
+                ASSERT_EQ(solution.flop_nodes[shard_start(NUM_FLOPS, 2, 3)].bet_total, 3);
+                ASSERT_EQ(solution.flop_nodes[shard_start(NUM_FLOPS, 1, 3)].action, ACTION_BET_2X);
+                free_solution(&solution);
+
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                ASSERT(!merge_flop_shards(&solution, paths, 2));
+                free_solution(&solution);
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', false)));
+                ASSERT(!merge_flop_shards(&solution, paths, 3));
+                free_solution(&solution);
+                for (uint32_t i = 0; i < 3; i += 1) {
+                        unlink(paths[i]);
+                }
+        }
+
+        {
+                printf("Testing equity\n");
+
+                struct Range *ranges = malloc(2 * sizeof(struct Range));
+                ASSERT(parse_range("AKs, TT+", &ranges[0]));
+                ASSERT_EQ(ranges[0].size, 4 + 5 * 6);
+                ASSERT(parse_range("A5s-A2s,22-44 KQo+", &ranges[0]));
+                ASSERT_EQ(ranges[0].size, 4 * 4 + 3 * 6 + 12);
+                ASSERT(parse_range("AhKd:0.5 AK", &ranges[0]));
+                ASSERT_EQ(ranges[0].size, 16);
+                ASSERT(!parse_range("AKs, TX+", &ranges[0]));
+                ASSERT(!parse_range("AA-KQ", &ranges[0]));
+
+                // On 2345, aces only tie when a six or an ace gives kings the same straight
+                struct EquityResult result;
+                Card board = create_card("2c") | create_card("3d") | create_card("4h") |
+                             create_card("5s");
+                ASSERT(parse_range("AhAs", &ranges[0]));
+                ASSERT(parse_range("KdKc", &ranges[1]));
+                ASSERT(compute_equity(&ranges[0], &ranges[1], board, 0, 1, &result));
+                ASSERT_EQ(result.wins, 38);
+                ASSERT_EQ(result.ties, 6);
+                ASSERT_EQ(result.losses, 0);
+
+                // Dead cards leave the deck, and a combo they touch leaves its range
+                ASSERT(parse_range("AhAs, AcAd", &ranges[0]));
+                ASSERT(parse_range("KdKc", &ranges[1]));
+                ASSERT(compute_equity(&ranges[0], &ranges[1], board,
+                                      create_card("6s") | create_card("Ac"), 3, &result));
+                ASSERT_EQ(ranges[0].size, 1);
+                ASSERT_EQ(result.wins, 38);
+                ASSERT_EQ(result.ties, 4);
+
+                // Combos the ranges share are never dealt against themselves or each other's cards
+                board |= create_card("9c");
+                ASSERT(parse_range("AA, KK", &ranges[0]));
+                ASSERT(parse_range("KK, AA", &ranges[1]));
+                ASSERT(compute_equity(&ranges[0], &ranges[1], board, 0, 1, &result));
+                ASSERT_EQ(result.wins, 36);
+                ASSERT_EQ(result.ties, 6 + 6);
+                ASSERT_EQ(result.losses, 36);
+                free(ranges);
+        }
+
+        {
+                printf("Testing query server\n");
+
+                char name[4];
+                starting_hand_name(create_card("Kd") | create_card("As"), name);
+                ASSERT(strcmp(name, "AKo") == 0);
+                starting_hand_name(create_card("Qh") | create_card("Qs"), name);
+                ASSERT(strcmp(name, "QQ") == 0);
+
+                // Hole cards move onto the suits their starting hand is solved with
+                Card board = create_card("Ts") | create_card("9c");
+                ASSERT_EQ(normalize_suits(create_card("Ks") | create_card("Ac"), &board),
+                          starting_hand_cards('A', 'K', false));
+                ASSERT_EQ(board, (create_card("Td") | create_card("9h")));
+                board = 0;
+                ASSERT_EQ(normalize_suits(create_card("2c") | create_card("7c"), &board),
+                          starting_hand_cards('7', '2', true));
+
+                // Invalid queries are answered without solving anything
+                struct SolutionCache cache;
+                char response[MAX_QUERY_RESPONSE];
+                ASSERT(init_solution_cache(&cache, 1, NULL));
+                ASSERT(!answer_query(&cache, "AhKd Ts9s", response, sizeof(response)));
+                ASSERT(!answer_query(&cache, "AhAh", response, sizeof(response)));
+                ASSERT(!answer_query(&cache, "AhKd Ts9s2c Ts", response, sizeof(response)));
+                ASSERT(strstr(response, "error"));
+                ASSERT_EQ(cache.size, 0);
+                free_solution_cache(&cache);
+        }
+
+        {
+                printf("Testing flop decision table\n");
+
+                ASSERT_EQ(starting_hand_index(starting_hand_cards('A', 'A', false)), 168);
+                ASSERT_EQ(starting_hand_index(starting_hand_cards('A', 'K', true)), 12 * 13 + 11);
+                ASSERT_EQ(starting_hand_index(starting_hand_cards('A', 'K', false)), 11 * 13 + 12);
+                ASSERT_EQ(starting_hand_index(starting_hand_cards('3', '2', false)), 1);
+
+                // Every flop in a suit-isomorphism class gets the decision of its canonical flop
+                const char *path = "/tmp/utx-test-flops.tbl";
+                struct Solution solution;
+                ASSERT(init_solution(&solution, starting_hand_cards('Q', 'J', true)));
+                Card flop = create_card("Ts") | create_card("9s") | create_card("2c");
+                struct FlopNode *node = (struct FlopNode *)find_flop_node(&solution, flop);
+                node->bet_total = 3 * HALF_UNITS * NUM_TURN_RIVERS * NUM_DEALER_HOLES;
+                node->check_total = 1 * HALF_UNITS * NUM_TURN_RIVERS * NUM_DEALER_HOLES;
+                struct FlopDecisionTable *table = load_flop_table(NULL);
+                ASSERT(table);
+                add_flop_decisions(table, &solution);
+                ASSERT(save_flop_table(table, path));
+                free(table);
+                free_solution(&solution);
+
+                const struct FlopDecisionTable *mapped = map_flop_table(path);
+                ASSERT(mapped);
+                ASSERT_EQ(mapped->hands_solved, 1);
+                enum Action action;
+                double margin;
+                Card hole = create_card("Qc") | create_card("Jc");
+                flop = create_card("Td") | create_card("9d") | create_card("2s");
+                ASSERT(lookup_flop_decision(mapped, hole, flop, &action, &margin));
+                ASSERT_EQ(action, ACTION_BET_2X);
+                ASSERT_EQ(margin, 2.0);
+                flop = create_card("Tc") | create_card("9d") | create_card("2s");
+                ASSERT(lookup_flop_decision(mapped, hole, flop, &action, &margin));
+                ASSERT_EQ(margin, 0.0);
+                hole = create_card("Qc") | create_card("Jd");
+                ASSERT(!lookup_flop_decision(mapped, hole, flop, &action, &margin));
+                unmap_flop_table(mapped);
+
+                // Adding hands keeps the ones already saved
+                table = load_flop_table(path);
+                ASSERT(table);
+                ASSERT_EQ(table->hands_solved, 1);
+                free(table);
+                unlink(path);
+        }
+
+        {
+                printf("Testing Monte Carlo estimates\n");
+
+                struct Xoshiro256 rng;
+                xoshiro_seed(&rng, 1, 0);
+                Card dead = create_card("Ah") | create_card("Ad");
+                for (int i = 0; i < 1000; i += 1) {
+                        Card cards = draw_cards(&rng, dead, 5);
+                        ASSERT_EQ(__builtin_popcountll(cards), 5);
+                        ASSERT_EQ((cards & (dead | 0xE000E000E000E000)), 0);
+                }
+
+                // Aces separate raising from checking within the first round
+                struct MonteCarloOptions options = DEFAULT_MONTE_CARLO_OPTIONS;
+                struct MonteCarloEstimate estimate;
+                ASSERT(estimate_hand(dead, &options, &estimate));
+                ASSERT(estimate.separated);
+                ASSERT_EQ(estimate.samples, MONTE_CARLO_SAMPLES_PER_ROUND);
+                ASSERT_EQ(estimated_action(&estimate), ACTION_RAISE_4X);
         }
 
         printf("All Tests Ran Successfully.\n");
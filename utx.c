@@ -1,230 +1,649 @@
-#include "eval.c"
+#include "flop_table.c"
+#include "montecarlo.c"
+#include "server.c"
+#include "shard.c"
+
+#include <errno.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+enum OutputFormat { FORMAT_TEXT, FORMAT_CSV, FORMAT_JSON };
+
+struct SolveOptions {
+        // Reuse or save runout tables here, if set
+        const char *cache_directory;
+        // Save runout tables and flop sweeps here as they go, and pick them up with `resume`
+        const char *checkpoint_directory;
+        bool resume;
+        // Estimate instead of solving exactly
+        bool monte_carlo;
+        struct MonteCarloOptions monte_carlo_options;
+        // With num_shards, only solve shard `shard` of them into files in cache_directory, or
+        // with `merge`, combine the files of every shard there instead of solving
+        uint32_t shard;
+        uint32_t num_shards;
+        bool merge;
+};
+
+struct HandResult {
+        char name[4];
+        struct Solution solution;
+        double seconds;
+        // Samples drawn and the widest 95% confidence half-width, for Monte Carlo estimates
+        uint64_t samples;
+        double ci;
+};
+
+/**
+ * Parses a starting hand like "AKs", "AKo" or "QQ" into ranks and suitedness. A missing s/o
+ * means offsuit. Returns false if it isn't a valid hand.
+ */
+bool parse_starting_hand(const char *name, char *first_rank, char *second_rank, bool *suited) {
+        size_t length = strlen(name);
+        if (length < 2 || length > 3 || !strchr(RANK_CHARS, name[0]) ||
+            !strchr(RANK_CHARS, name[1])) {
+                return false;
+        }
 
-#include <stdlib.h>
+        *first_rank = name[0];
+        *second_rank = name[1];
+        *suited = length == 3 && name[2] == 's';
 
-const double ANTE = 1.0;
-const double BLIND = 1.0;
+        if (length == 3 && name[2] != 's' && name[2] != 'o') {
+                return false;
+        }
+        return !(*first_rank == *second_rank && *suited);
+}
 
-uint64_t lookup_table[2118760];
-double flop_scoring_table[2118760];
-double river_scoring_table[2118760];
+double elapsed_seconds(const struct timespec *start) {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
 
-double max(double a, double b) { return a > b ? a : b; }
+/**
+ * Writes the flop strategy of the last solved hand to DIR/HAND.csv: every flop, the class it was
+ * solved through, both flop EVs, the best action and how many river boards fold after a check
+ */
+bool write_strategy(const char *directory, const struct HandResult *result) {
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s.csv", directory, result->name);
+
+        FILE *file = fopen(path, "w");
+        if (file == NULL) {
+                fprintf(stderr, "Could not write strategy to %s\n", path);
+                return false;
+        }
 
-// https://stackoverflow.com/questions/506807/creating-multiple-numbers-with-certain-number-of-bits-set
-uint64_t next_combination(uint64_t x, uint64_t deadzones) {
-        do {
-                uint64_t smallest = (x & -x);
-                uint64_t ripple = x + smallest;
-                uint64_t new_smallest = ripple & -ripple;
-                x = ripple | ((new_smallest / smallest) >> 1) - 1;
-        } while (x & deadzones);
+        const struct Solution *solution = &result->solution;
+        fprintf(file, "flop,canonical,weight,bet_ev,check_ev,action,river_folds\n");
+        for (uint32_t i = 0; i < NUM_FLOPS; i += 1) {
+                Card flop = nth_combination(i, 3, solution->deck);
+                const struct FlopNode *node = find_flop_node(solution, flop);
+                char flop_name[7], canonical_name[7];
+                format_cards(flop, flop_name);
+                format_cards(nth_combination(node - solution->flop_nodes, 3, solution->deck),
+                             canonical_name);
+
+                fprintf(file, "%s,%s,%u,%.9f,%.9f,%s,%u\n", flop_name, canonical_name,
+                        node->weight, flop_node_ev(node->bet_total),
+                        flop_node_ev(node->check_total), ACTION_NAMES[node->action],
+                        node->river_folds);
+        }
 
-        return x;
+        fclose(file);
+        return true;
 }
 
-double blind_payout(uint32_t score) {
-        if (score == 0) { // royal flush
-                return 500.0;
-        } else if (score < STRAIGHT_FLUSH_INDEX + NUM_STRAIGHT_FLUSHES) {
-                return 50.0;
-        } else if (score < FOUR_OF_A_KIND_INDEX + NUM_FOUR_OF_A_KINDS) {
-                return 10.0;
-        } else if (score < FLUSH_INDEX + NUM_FLUSHES) {
-                return 1.5;
-        } else if (score < STRAIGHT_INDEX + NUM_STRAIGHTS) {
-                return 1.0;
-        } else {
-                // did not qualify
-                return 0.0;
+/**
+ * Estimates a starting hand's preflop EVs into result. Only the EVs and action of the solution
+ * are set. Returns false if the estimate can't be allocated.
+ */
+bool estimate(Card hand, const struct MonteCarloOptions *options, struct HandResult *result) {
+        struct MonteCarloEstimate estimate;
+        if (!estimate_hand(hand, options, &estimate)) {
+                return false;
         }
+
+        memset(&result->solution, 0, sizeof(result->solution));
+        result->solution.hand = hand;
+        result->solution.raise4_ev = estimate.evs[MC_RAISE4];
+        result->solution.raise3_ev = estimate.evs[MC_RAISE3];
+        result->solution.check_ev = estimate.evs[MC_CHECK];
+        result->solution.action = estimated_action(&estimate);
+        result->samples = estimate.samples;
+        result->ci = max(max(estimate.cis[MC_RAISE4], estimate.cis[MC_RAISE3]),
+                         estimate.cis[MC_CHECK]);
+        return true;
 }
 
-double get_payout(uint64_t hand, uint64_t board, uint64_t dealer, double bet) {
-        uint32_t player_score = eval_hand(board | hand);
-        uint32_t dealer_score = eval_hand(board | dealer);
+/**
+ * Writes the path of the file of shard `shard` of `num_shards` of a hand's runout or flop phase,
+ * like DIR/runout-AKo-2-of-8.tbl
+ */
+void shard_path(char *path, size_t size, const char *directory, const char *phase,
+                const char *name, uint32_t shard, uint32_t num_shards) {
+        snprintf(path, size, "%s/%s-%s-%u-of-%u.tbl", directory, phase, name, shard + 1,
+                 num_shards);
+}
 
-        if (player_score < dealer_score) { // player wins
-                double ante = dealer_score < HIGH_CARD_INDEX ? ANTE : 0;
-                double blind = blind_payout(player_score);
+/**
+ * Returns the shard_path of every shard, freed with a single free. Returns NULL if it can't be
+ * allocated.
+ */
+const char **shard_paths(const char *directory, const char *phase, const char *name,
+                         uint32_t num_shards) {
+        const size_t size = 4096;
+        const char **paths = malloc(num_shards * (sizeof(char *) + size));
+        if (!paths) {
+                fprintf(stderr, "Could not allocate shard paths\n");
+                return NULL;
+        }
 
-                return ante + blind + bet;
-        } else if (player_score > dealer_score) {
-                return -(ANTE + BLIND + bet);
-        } else {
-                // push
-                return 0.0;
+        char *strings = (char *)(paths + num_shards);
+        for (uint32_t shard = 0; shard < num_shards; shard += 1) {
+                shard_path(strings + shard * size, size, directory, phase, name, shard, num_shards);
+                paths[shard] = strings + shard * size;
         }
+        return paths;
 }
 
-double simulate_runout(uint64_t hand, uint64_t deck) {
-        printf("Simulating runout\n");
-        uint64_t board = 0x1F;
-        double total = 0.0;
+/**
+ * Solves one shard of a starting hand into the cache directory. Until the hand's runout table
+ * is merged into DIR/runout-HAND.tbl, a shard builds a range of runout chunks, and after that a
+ * range of flops.
+ */
+bool solve_shard(Card hand, const struct SolveOptions *options) {
+        char name[4], runout_path[4096], path[4096];
+        starting_hand_name(hand, name);
+        snprintf(runout_path, sizeof(runout_path), "%s/runout-%s.tbl", options->cache_directory,
+                 name);
+
+        const struct RunoutTable *runout = map_runout_table(runout_path, hand);
+        bool merged = runout && runout->chunks_done == NUM_RUNOUT_CHUNKS;
+        if (runout) {
+                unmap_table_file(runout, runout_table_size(runout->chunks_done));
+        }
 
-        // problem space reductions:
-        // # clubs > # spades -> skip
-        // # clubs < # spades -> x2
+        shard_path(path, sizeof(path), options->cache_directory, merged ? "flop" : "runout", name,
+                   options->shard, options->num_shards);
+        bool ok = merged ? solve_flop_shard(hand, options->shard, options->num_shards,
+                                            runout_path, path)
+                         : solve_runout_shard(hand, options->shard, options->num_shards, path);
+        fprintf(stderr, ok ? "Wrote %s\n" : "Could not write %s\n", path);
+        return ok;
+}
 
-        const uint64_t deadzones = 0xE000E000E000E000;
-        const uint64_t runouts = 2118760;  // 50 choose 5
-        const uint64_t dealer_cards = 990; // 45 choose 2
+/**
+ * Solves a starting hand from the shard files in the cache directory. Its runout shards are
+ * merged into DIR/runout-HAND.tbl unless that is already there. Its flop shards are merged if
+ * there are any, and otherwise the flops are solved here.
+ */
+bool merge_hand(Card hand, const struct SolveOptions *options, struct Solution *solution) {
+        const char *directory = options->cache_directory;
+        char name[4], runout_path[4096];
+        starting_hand_name(hand, name);
+        snprintf(runout_path, sizeof(runout_path), "%s/runout-%s.tbl", directory, name);
+        if (!init_solution(solution, hand)) {
+                return false;
+        }
 
-        if (hand & board) {
-                board = next_combination(board, deadzones | hand);
+        bool ok = true;
+        if (!load_runout_table(solution, runout_path)) {
+                const char **paths = shard_paths(directory, "runout", name, options->num_shards);
+                ok = paths && merge_runout_shards(solution, paths, options->num_shards);
+                free(paths);
+                if (ok && !save_runout_table(solution, runout_path)) {
+                        fprintf(stderr, "Could not write %s\n", runout_path);
+                        ok = false;
+                }
         }
 
-        uint32_t count = 0;
-        for (int i = 0; i < runouts; i += 1) {
-                uint64_t dealer = 0x3;
-                double reduction_scalar = 1.0;
-                double subtotal = 0.0;
-                double flop_total = 0.0;
-                double river_total = 0.0;
-                bool skip = false;
+        const char **paths = ok ? shard_paths(directory, "flop", name, options->num_shards) : NULL;
+        if (paths && access(paths[0], F_OK) == 0) {
+                ok = merge_flop_shards(solution, paths, options->num_shards);
+        } else if (paths) {
+                struct SolveFiles files = {NULL, NULL, false, false};
+                simulate_flop(solution, &files, 0, NUM_FLOPS);
+        } else {
+                ok = false;
+        }
+        free(paths);
 
-                uint64_t clubs = (board & CLUB_BITMASK) >> CLUB_OFFSET;
-                uint64_t diamonds = (board & DIAMOND_BITMASK) >> DIAMOND_OFFSET;
-                uint64_t hearts = (board & HEART_BITMASK) >> HEART_OFFSET;
-                uint64_t spades = (board & SPADE_BITMASK) >> SPADE_OFFSET;
-                bool rainbow = clubs != 0 && hearts != 0 && diamonds != 0 && spades != 0;
+        if (!ok) {
+                free_solution(solution);
+                return false;
+        }
+        finish_solution(solution);
+        return true;
+}
 
-                if (dealer & board) {
-                        dealer = next_combination(dealer, deadzones | hand | board);
-                }
+/**
+ * Solves a starting hand. With a cache directory, its runout table is reused from, or saved to,
+ * DIR/runout-HAND.tbl. With a checkpoint directory, the runout table is kept there instead, along
+ * with DIR/flop-HAND.tbl.
+ */
+bool simulate(char first_rank, char second_rank, bool suited, const struct SolveOptions *options,
+              struct HandResult *result) {
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        snprintf(result->name, sizeof(result->name), "%c%c%s", first_rank, second_rank,
+                 first_rank == second_rank ? "" : suited ? "s" : "o");
+        Card hand = starting_hand_cards(first_rank, second_rank, suited);
+
+        result->samples = 0;
+        result->ci = 0.0;
+        if (options->monte_carlo) {
+                bool ok = estimate(hand, &options->monte_carlo_options, result);
+                result->seconds = elapsed_seconds(&start);
+                return ok;
+        }
+        if (options->merge) {
+                bool ok = merge_hand(hand, options, &result->solution);
+                result->seconds = elapsed_seconds(&start);
+                return ok;
+        }
 
-                if (clubs > spades) {
-                        skip = true;
-                } else if (clubs < spades) {
-                        reduction_scalar *= 2;
-                }
+        const char *runout_directory = options->checkpoint_directory ? options->checkpoint_directory
+                                                                     : options->cache_directory;
+        char runout_path[4096], flop_path[4096];
+        struct SolveFiles files = {NULL, NULL, options->checkpoint_directory != NULL,
+                                   options->resume};
+        if (runout_directory) {
+                snprintf(runout_path, sizeof(runout_path), "%s/runout-%s.tbl", runout_directory,
+                         result->name);
+                files.runout_path = runout_path;
+        }
+        if (options->checkpoint_directory) {
+                snprintf(flop_path, sizeof(flop_path), "%s/flop-%s.tbl",
+                         options->checkpoint_directory, result->name);
+                files.flop_path = flop_path;
+        }
+        if (!solve_hand(hand, &files, &result->solution)) {
+                return false;
+        }
+        result->seconds = elapsed_seconds(&start);
+        return true;
+}
 
-                if (!skip) {
-                        count += 1;
-                        for (int k = 0; k < dealer_cards; k += 1) {
-                                // printf("dealer: %lx\n", dealer);
-                                subtotal += get_payout(hand, board, dealer, 4.0);
-                                flop_total += get_payout(hand, board, dealer, 2.0);
-                                river_total += get_payout(hand, board, dealer, 1.0);
-
-                                if (k != dealer_cards - 1) {
-                                        dealer = next_combination(dealer, deadzones | hand | board);
-                                }
-                        }
+/**
+ * Prints one hand. Monte Carlo estimates also report their sample count and widest 95%
+ * confidence half-width.
+ */
+void print_result(enum OutputFormat format, const struct HandResult *result, bool first) {
+        const struct Solution *solution = &result->solution;
+        const char *decision = ACTION_NAMES[solution->action];
+        bool sampled = result->samples > 0;
+
+        switch (format) {
+        case FORMAT_TEXT:
+                printf("hold ev: %f, bet 3x ev: %f, bet 4x ev: %f\n", solution->check_ev,
+                       solution->raise3_ev, solution->raise4_ev);
+                printf("Score for %s: %f (%s)", result->name,
+                       max(max(solution->raise4_ev, solution->raise3_ev), solution->check_ev),
+                       decision);
+                if (sampled) {
+                        printf(" +/- %f from %lu samples", result->ci, result->samples);
                 }
-
-                total += reduction_scalar * subtotal;
-                lookup_table[i] = board;
-                flop_scoring_table[i] = flop_total;
-                river_scoring_table[i] = river_total;
-
-                if (i != runouts - 1) {
-                        board = next_combination(board, deadzones | hand);
+                printf("\n");
+                break;
+        case FORMAT_CSV:
+                printf("%s,%.9f,%.9f,%.9f,%s,%.3f", result->name, solution->raise4_ev,
+                       solution->raise3_ev, solution->check_ev, decision, result->seconds);
+                if (sampled) {
+                        printf(",%lu,%.9f", result->samples, result->ci);
                 }
+                printf("\n");
+                break;
+        case FORMAT_JSON:
+                printf("%s\n  {\"hand\": \"%s\", \"raise_ev\": %.9f, \"raise3_ev\": %.9f, "
+                       "\"check_ev\": %.9f, \"decision\": \"%s\", \"seconds\": %.3f",
+                       first ? "" : ",", result->name, solution->raise4_ev, solution->raise3_ev,
+                       solution->check_ev, decision, result->seconds);
+                if (sampled) {
+                        printf(", \"samples\": %lu, \"ci\": %.9f", result->samples, result->ci);
+                }
+                printf("}");
+                break;
         }
-
-        printf("total (count %d): %f\n", count, total / (runouts * dealer_cards));
-        return total / (runouts * dealer_cards);
+        fflush(stdout);
 }
 
-double simulate_river(uint64_t hand, uint64_t board, uint64_t deck, bool flop_bet) {
-        uint64_t river = 0x3;
-        double total = 0.0;
-
-        const uint64_t deadzones = 0xE000E000E000E000;
-        const uint32_t runouts = 1081;     // 47 choose 3
-        const uint32_t dealer_cards = 990; // 45 choose 2
-
-        if ((hand | board) & river) {
-                river = next_combination(river, deadzones | hand | board);
-        }
-
-        for (int i = 0; i < runouts; i += 1) {
-                uint32_t l = 0;
-                uint32_t r = 2118760;
-                uint32_t index = UINT32_MAX;
-                uint64_t cc = board | river;
-                while (l != r) {
-                        uint32_t mid = (l + r) / 2;
-                        // printf("%lx => [%d, %d], mid=%lx\n", cc, l, r, lookup_table[mid]);
-                        if (lookup_table[mid] > cc) {
-                                r = mid;
-                        } else if (lookup_table[mid] < cc) {
-                                l = mid;
+/**
+ * Fills `hands` with all 169 starting hands, from AA down, and returns how many were written
+ */
+int all_starting_hands(char hands[][4]) {
+        int count = 0;
+        for (int high = 12; high >= 0; high -= 1) {
+                for (int low = high; low >= 0; low -= 1) {
+                        if (high == low) {
+                                snprintf(hands[count++], 4, "%c%c", RANK_CHARS[high],
+                                         RANK_CHARS[low]);
                         } else {
-                                index = mid;
-                                break;
+                                snprintf(hands[count++], 4, "%c%cs", RANK_CHARS[high],
+                                         RANK_CHARS[low]);
+                                snprintf(hands[count++], 4, "%c%co", RANK_CHARS[high],
+                                         RANK_CHARS[low]);
                         }
                 }
+        }
 
-                total += flop_bet ? flop_scoring_table[index]
-                                  : max(river_scoring_table[index], -ANTE - BLIND);
+        return count;
+}
 
-                if (i != runouts - 1) {
-                        river = next_combination(river, deadzones | hand | board);
-                }
+/**
+ * Creates `path` unless it already exists. A NULL path is left alone.
+ */
+bool create_directory(const char *path) {
+        if (path && mkdir(path, 0777) != 0 && errno != EEXIST) {
+                fprintf(stderr, "Could not create %s\n", path);
+                return false;
         }
-
-        return total / (runouts * dealer_cards);
+        return true;
 }
 
-double simulate_flop(uint64_t hand, uint64_t deck) {
-        uint64_t board = 0x7;
-        double total = 0.0;
+/**
+ * Runs the query server, or its load test, with `hands` solved up front. The load test talks to
+ * the server at `socket_path` if it is set, and otherwise answers in this process.
+ */
+int serve(const struct SolveOptions *options, const char *socket_path, uint32_t lru_capacity,
+          uint64_t load_queries, char (*hands)[4], int num_hands) {
+        Card *cards = malloc((num_hands ? num_hands : 1) * sizeof(Card));
+        if (!cards) {
+                fprintf(stderr, "Could not allocate hands\n");
+                return 1;
+        }
+        for (int i = 0; i < num_hands; i += 1) {
+                char first_rank, second_rank;
+                bool suited;
+                if (!parse_starting_hand(hands[i], &first_rank, &second_rank, &suited)) {
+                        fprintf(stderr, "Invalid hand '%s'\n", hands[i]);
+                        free(cards);
+                        return 1;
+                }
+                Card board = 0;
+                cards[i] = normalize_suits(starting_hand_cards(first_rank, second_rank, suited),
+                                           &board);
+        }
 
-        const uint64_t deadzones = 0xE000E000E000E000;
-        const uint64_t runouts = 19600; // 50 choose 3
+        bool ok = true;
+        struct SolutionCache cache;
+        bool local = !load_queries || !socket_path;
+        if (load_queries && lru_capacity < (uint32_t)num_hands) {
+                // The load test only times cached states, so none of its hands may be evicted
+                lru_capacity = num_hands;
+        }
+        if (local) {
+                if (!init_solution_cache(&cache, lru_capacity, options->cache_directory)) {
+                        free(cards);
+                        return 1;
+                }
+                for (int i = 0; ok && i < num_hands; i += 1) {
+                        ok = cached_solution(&cache, cards[i]) != NULL;
+                }
+        }
+
+        if (ok && load_queries) {
+                ok = run_load_test(&cache, socket_path, cards, num_hands, load_queries);
+        } else if (ok && socket_path) {
+                ok = serve_socket(&cache, socket_path);
+        } else if (ok) {
+                serve_stream(&cache, stdin, stdout);
+        }
 
-        if (hand & board) {
-                board = next_combination(board, deadzones | hand);
+        if (local) {
+                free_solution_cache(&cache);
         }
+        free(cards);
+        return ok ? 0 : 1;
+}
 
-        for (int i = 0; i < runouts; i += 1) {
+void usage(const char *program) {
+        fprintf(stderr,
+                "usage: %s [-t threads] [--format text|csv|json] [--strategy dir] [--cache dir]\n"
+                "          [--checkpoint dir [--checkpoint-interval s] [--resume]]\n"
+                "          [--progress-rate n]\n"
+                "          [--monte-carlo [--samples n] [--ci w] [--separation z] [--seed s]]\n"
+                "          [--flop-table file]\n"
+                "          [--serve [--socket path] [--lru n] | --load-test n [--socket path]]\n"
+                "          [--shard i/N] [--all | hand...]\n"
+                "       %s merge --cache dir --shards N [-t threads] [--format text|csv|json]\n"
+                "          [--strategy dir] [--flop-table file] [--all | hand...]\n"
+                "  hands are written like AKs, AKo or QQ; the default is AKo\n"
+                "  --strategy writes each hand's flop decisions to dir/HAND.csv\n"
+                "  --cache keeps each hand's runout table in dir, and reuses it on later runs\n"
+                "  --checkpoint saves each hand's runout table and flop sweep to dir every\n"
+                "    --checkpoint-interval seconds (default 60); --resume continues from them\n"
+                "  --flop-table adds each hand's flop decisions to file, a table every hand can\n"
+                "    be looked up in later; hands already in it are kept\n"
+                "  --progress-rate prints at most n progress updates a second (default 2)\n"
+                "  --monte-carlo estimates the preflop EVs by sampling instead, stopping at\n"
+                "    --samples n, a 95%% confidence half-width of --ci w, or once raise and\n"
+                "    check are --separation z standard errors apart; --seed picks the samples.\n"
+                "    Samples are drawn in rounds of %d, so --samples is rounded up to one\n"
+                "  --serve answers queries like \"AhKd\", \"AhKd Ts9s2c\" or\n"
+                "    \"AhKd Ts9s2c 4h5d\", one per line, on stdin or a Unix --socket, keeping\n"
+                "    the --lru n (default 16) most recent solved hands; the hands given are\n"
+                "    solved first\n"
+                "  --load-test sends n random queries for the hands given (default AKo) and\n"
+                "    prints latency percentiles, to the server at --socket or else in this\n"
+                "    process; a --serve process it talks to needs an --lru of at least as many\n"
+                "    hands\n"
+                "  --shard solves only the i-th of N equal parts of each hand into files in the\n"
+                "    --cache dir, where merge then combines all N into the same result as\n"
+                "    solving in one go; N is at most %d. Shards build the runout until merge\n"
+                "    has saved it, and the flops after that; merge solves the flops itself if\n"
+                "    they weren't sharded\n"
+                "  UTX_ISA=x86-64|x86-64-v2|x86-64-v3|x86-64-v4 in the environment picks the\n"
+                "  instruction set level of the hot kernels, instead of the best one the CPU has\n"
+                "  UTX_HASH_TABLE=file keeps the hash evaluator table there, instead of in\n"
+                "  $XDG_CACHE_HOME/utx or ~/.cache/utx\n",
+                program, program, MONTE_CARLO_SAMPLES_PER_ROUND, NUM_RUNOUT_CHUNKS);
+}
 
-                total += max(simulate_river(hand, board, deck, false),
-                             simulate_river(hand, board, deck, true));
-                printf("Evaluated flop %d/19600\n", i);
+int main(int argc, char **argv) {
+        enum OutputFormat format = FORMAT_TEXT;
+        char(*hands)[4] = malloc(169 * argc * sizeof(*hands));
+        int num_hands = 0;
+        const char *strategy_directory = NULL;
+        const char *flop_table_path = NULL;
+        struct SolveOptions options = {.monte_carlo_options = DEFAULT_MONTE_CARLO_OPTIONS};
+        bool serving = false;
+        const char *socket_path = NULL;
+        uint32_t lru_capacity = DEFAULT_LRU_CAPACITY;
+        uint64_t load_queries = 0;
+
+        int first_arg = 1;
+        if (argc > 1 && strcmp(argv[1], "merge") == 0) {
+                options.merge = true;
+                first_arg = 2;
+        }
 
-                if (i != runouts - 1) {
-                        board = next_combination(board, deadzones | hand);
+        num_threads = sysconf(_SC_NPROCESSORS_ONLN);
+        for (int i = first_arg; i < argc; i += 1) {
+                if ((strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--threads") == 0) &&
+                    i + 1 < argc) {
+                        num_threads = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+                        i += 1;
+                        if (strcmp(argv[i], "csv") == 0) {
+                                format = FORMAT_CSV;
+                        } else if (strcmp(argv[i], "json") == 0) {
+                                format = FORMAT_JSON;
+                        } else if (strcmp(argv[i], "text") == 0) {
+                                format = FORMAT_TEXT;
+                        } else {
+                                usage(argv[0]);
+                                return 1;
+                        }
+                } else if (strcmp(argv[i], "--strategy") == 0 && i + 1 < argc) {
+                        strategy_directory = argv[++i];
+                } else if (strcmp(argv[i], "--flop-table") == 0 && i + 1 < argc) {
+                        flop_table_path = argv[++i];
+                } else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+                        options.cache_directory = argv[++i];
+                } else if (strcmp(argv[i], "--checkpoint") == 0 && i + 1 < argc) {
+                        options.checkpoint_directory = argv[++i];
+                } else if (strcmp(argv[i], "--checkpoint-interval") == 0 && i + 1 < argc) {
+                        checkpoint_interval = atof(argv[++i]);
+                } else if (strcmp(argv[i], "--resume") == 0) {
+                        options.resume = true;
+                } else if (strcmp(argv[i], "--progress-rate") == 0 && i + 1 < argc) {
+                        progress_rate = atof(argv[++i]);
+                } else if (strcmp(argv[i], "--monte-carlo") == 0) {
+                        options.monte_carlo = true;
+                } else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+                        options.monte_carlo_options.max_samples = strtoull(argv[++i], NULL, 10);
+                } else if (strcmp(argv[i], "--ci") == 0 && i + 1 < argc) {
+                        options.monte_carlo_options.target_ci = atof(argv[++i]);
+                } else if (strcmp(argv[i], "--separation") == 0 && i + 1 < argc) {
+                        options.monte_carlo_options.separation = atof(argv[++i]);
+                } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+                        options.monte_carlo_options.seed = strtoull(argv[++i], NULL, 10);
+                } else if (strcmp(argv[i], "--serve") == 0) {
+                        serving = true;
+                } else if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) {
+                        socket_path = argv[++i];
+                } else if (strcmp(argv[i], "--lru") == 0 && i + 1 < argc) {
+                        lru_capacity = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "--load-test") == 0 && i + 1 < argc) {
+                        load_queries = strtoull(argv[++i], NULL, 10);
+                } else if (strcmp(argv[i], "--shard") == 0 && i + 1 < argc && !options.merge) {
+                        if (!parse_shard(argv[++i], &options.shard, &options.num_shards)) {
+                                usage(argv[0]);
+                                return 1;
+                        }
+                } else if (strcmp(argv[i], "--shards") == 0 && i + 1 < argc && options.merge) {
+                        options.num_shards = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "--all") == 0) {
+                        num_hands += all_starting_hands(hands + num_hands);
+                } else if (argv[i][0] != '-' && strlen(argv[i]) < 4) {
+                        snprintf(hands[num_hands++], 4, "%s", argv[i]);
+                } else {
+                        usage(argv[0]);
+                        return 1;
                 }
         }
+        if (num_threads < 1) {
+                num_threads = 1;
+        }
+        if (num_hands == 0 && (!serving || load_queries)) {
+                snprintf(hands[num_hands++], 4, "AKo");
+        }
+        if (progress_rate <= 0.0) {
+                progress_rate = 2.0;
+        }
+        if (options.monte_carlo &&
+            (strategy_directory || flop_table_path || options.cache_directory ||
+             options.checkpoint_directory)) {
+                fprintf(stderr, "--monte-carlo has no flop strategy or runout tables\n");
+                return 1;
+        }
+        if (options.monte_carlo &&
+            options.monte_carlo_options.max_samples < MONTE_CARLO_SAMPLES_PER_ROUND) {
+                fprintf(stderr, "--samples must be at least %d\n", MONTE_CARLO_SAMPLES_PER_ROUND);
+                return 1;
+        }
+        if (options.resume && !options.checkpoint_directory) {
+                fprintf(stderr, "--resume needs --checkpoint\n");
+                return 1;
+        }
+        if ((serving || load_queries) &&
+            (options.monte_carlo || strategy_directory || flop_table_path ||
+             options.checkpoint_directory)) {
+                fprintf(stderr, "--serve and --load-test only take --cache\n");
+                return 1;
+        }
 
-        return total / runouts;
-}
+        if (options.merge && (options.num_shards < 1 || options.num_shards > NUM_RUNOUT_CHUNKS)) {
+                fprintf(stderr, "merge needs --shards between 1 and %d\n", NUM_RUNOUT_CHUNKS);
+                return 1;
+        }
+        if (options.num_shards && !options.cache_directory) {
+                fprintf(stderr, "--shard and merge need --cache\n");
+                return 1;
+        }
+        if (options.num_shards &&
+            (options.monte_carlo || options.checkpoint_directory || serving || load_queries ||
+             (!options.merge && (strategy_directory || flop_table_path)))) {
+                fprintf(stderr, "--shard only takes --cache, and merge no --checkpoint, "
+                                "--monte-carlo or --serve\n");
+                return 1;
+        }
 
-double simulate(char first_rank, char second_rank, bool suited) {
-        int ante = 1;
-        int blind = ante;
-        double bet = 0.0;
+        // Tables are built once and shared by every hand in the batch
+        if (!init_engine(ENGINE_HASH)) {
+                return 1;
+        }
 
-        // Hole cards
-        char card[3] = "_h\0";
-        card[0] = first_rank;
-        uint64_t first_card = create_card(card);
+        if (!create_directory(strategy_directory) || !create_directory(options.cache_directory) ||
+            !create_directory(options.checkpoint_directory)) {
+                return 1;
+        }
 
-        card[0] = second_rank;
-        card[1] = suited ? 'h' : 'd';
-        uint64_t second_card = create_card(card);
+        if (serving || load_queries) {
+                int status = serve(&options, socket_path, lru_capacity, load_queries, hands,
+                                   num_hands);
+                free(hands);
+                return status;
+        }
 
-        uint64_t deck = 0x1FFF1FFF1FFF1FFF ^ (first_card | second_card);
+        struct FlopDecisionTable *flop_table = NULL;
+        if (flop_table_path && !(flop_table = load_flop_table(flop_table_path))) {
+                return 1;
+        }
 
-        double maxbet_ev = simulate_runout(first_card | second_card, deck);
-        double flop_ev = simulate_flop(first_card | second_card, deck);
+        if (format == FORMAT_CSV) {
+                printf("hand,raise_ev,raise3_ev,check_ev,decision,seconds%s\n",
+                       options.monte_carlo ? ",samples,ci" : "");
+        } else if (format == FORMAT_JSON) {
+                printf("[");
+        }
 
-        printf("hold ev: %f, bet ev: %f", flop_ev, maxbet_ev);
+        for (int i = 0; i < num_hands; i += 1) {
+                char first_rank, second_rank;
+                bool suited;
+                if (!parse_starting_hand(hands[i], &first_rank, &second_rank, &suited)) {
+                        fprintf(stderr, "Invalid hand '%s'\n", hands[i]);
+                        return 1;
+                }
 
-        return max(maxbet_ev, flop_ev);
-}
+                if (options.num_shards && !options.merge) {
+                        if (!solve_shard(starting_hand_cards(first_rank, second_rank, suited),
+                                         &options)) {
+                                return 1;
+                        }
+                        continue;
+                }
 
-int main(int argc, char **argv) {
-        init_high_cards();
-        bool suited = false;
-        char r1 = 'A';
-        char r2 = 'K';
-        double score = simulate(r1, r2, suited);
+                struct HandResult result;
+                if (!simulate(first_rank, second_rank, suited, &options, &result)) {
+                        return 1;
+                }
+                print_result(format, &result, i == 0);
+
+                bool written = !strategy_directory || write_strategy(strategy_directory, &result);
+                if (flop_table) {
+                        // Saved after every hand, so a long --all run keeps what it has solved
+                        add_flop_decisions(flop_table, &result.solution);
+                        if (!save_flop_table(flop_table, flop_table_path)) {
+                                fprintf(stderr, "Could not write %s\n", flop_table_path);
+                                written = false;
+                        }
+                }
+                free_solution(&result.solution);
+                if (!written) {
+                        return 1;
+                }
+        }
 
-        printf("Score for %s %c%c: %f\n", suited ? "suited" : "unsuited", r1, r2, score);
+        if (format == FORMAT_JSON) {
+                printf("\n]\n");
+        }
 
+        free(flop_table);
+        free(hands);
         return 0;
 }
@@ -0,0 +1,449 @@
+#include "engine.c"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Exhaustive differential check of the evaluators. Every one of the 133,784,560 seven-card hands
+// is scored by each engine and compared against a reference that takes the best of its 21
+// five-card subsets. The reference ranks five-card hands from first principles (category, then
+// ranks by multiplicity), sharing no code or tables with the evaluators. Per-category counts are
+// also checked against the known totals.
+//
+// Cards are numbered rank * 4 + suit, so the nested loops below produce every hand with its
+// cards sorted by rank, and a subset's ranks can be read off in order without sorting.
+
+#define ALL_HANDS 133784560 // 52 choose 7
+#define NUM_RANK_KEYS 371293 // 13^5, five sorted ranks in base 13
+#define MAX_REPORTED_MISMATCHES 10
+
+enum Category {
+        CATEGORY_STRAIGHT_FLUSH,
+        CATEGORY_QUADS,
+        CATEGORY_FULL_HOUSE,
+        CATEGORY_FLUSH,
+        CATEGORY_STRAIGHT,
+        CATEGORY_TRIPS,
+        CATEGORY_TWO_PAIR,
+        CATEGORY_PAIR,
+        CATEGORY_HIGH_CARD,
+        NUM_CATEGORIES
+};
+
+const char *CATEGORY_NAMES[NUM_CATEGORIES] = {"straight flush", "quads", "full house",
+                                              "flush",          "straight", "trips",
+                                              "two pair",       "pair",  "high card"};
+
+// https://en.wikipedia.org/wiki/Poker_probability, 7-card hands
+const uint64_t CATEGORY_TOTALS[NUM_CATEGORIES] = {41584,   224848,   3473184,  4047644, 6180020,
+                                                  6461620, 31433400, 58627800, 23294460};
+
+// Five-card reference scores: by sorted rank key when the cards aren't suited, and by rank mask
+// when they are
+uint16_t reference_rank_scores[NUM_RANK_KEYS];
+uint16_t reference_flush_scores[1 << 13];
+
+// The 15 ways to pick 4 of the first 6 cards of a hand, which with the last card make up the
+// subsets that change as it does
+uint8_t subsets_of_six[15][4];
+
+/**
+ * Returns the category a 0..7461 score falls in
+ */
+enum Category score_category(uint32_t score) {
+        const uint32_t starts[NUM_CATEGORIES] = {STRAIGHT_FLUSH_INDEX, FOUR_OF_A_KIND_INDEX,
+                                                 FULL_HOUSE_INDEX,     FLUSH_INDEX,
+                                                 STRAIGHT_INDEX,       TRIPS_INDEX,
+                                                 TWO_PAIR_INDEX,       PAIR_INDEX,
+                                                 HIGH_CARD_INDEX};
+        enum Category category = CATEGORY_STRAIGHT_FLUSH;
+        while (category + 1 < NUM_CATEGORIES && score >= starts[category + 1]) {
+                category += 1;
+        }
+        return category;
+}
+
+/**
+ * Returns the strength of five ranks, sorted ascending, where higher is better: the category in
+ * the top digit, then the ranks ordered by multiplicity and then rank, in base 13
+ */
+uint64_t five_card_strength(const uint32_t ranks[5], bool flush) {
+        uint32_t counts[13] = {0};
+        for (int i = 0; i < 5; i += 1) {
+                counts[ranks[i]] += 1;
+        }
+
+        // Ranks in tiebreak order: most copies first, then highest
+        uint32_t order[5];
+        uint32_t max_count = 0;
+        int n = 0;
+        for (uint32_t count = 4; count >= 1; count -= 1) {
+                for (int rank = 12; rank >= 0; rank -= 1) {
+                        if (counts[rank] == count) {
+                                order[n++] = rank;
+                                max_count = max_count ? max_count : count;
+                        }
+                }
+        }
+
+        bool wheel = n == 5 && ranks[4] == 12 && ranks[3] == 3;
+        bool straight = n == 5 && (ranks[4] - ranks[0] == 4 || wheel);
+        uint32_t top = wheel ? 3 : ranks[4];
+
+        enum Category category;
+        if (straight && flush) {
+                category = CATEGORY_STRAIGHT_FLUSH;
+        } else if (max_count == 4) {
+                category = CATEGORY_QUADS;
+        } else if (max_count == 3 && n == 2) {
+                category = CATEGORY_FULL_HOUSE;
+        } else if (flush) {
+                category = CATEGORY_FLUSH;
+        } else if (straight) {
+                category = CATEGORY_STRAIGHT;
+        } else if (max_count == 3) {
+                category = CATEGORY_TRIPS;
+        } else if (max_count == 2 && n == 3) {
+                category = CATEGORY_TWO_PAIR;
+        } else if (max_count == 2) {
+                category = CATEGORY_PAIR;
+        } else {
+                category = CATEGORY_HIGH_CARD;
+        }
+
+        uint64_t strength = NUM_CATEGORIES - category;
+        for (int i = 0; i < 5; i += 1) {
+                uint32_t digit = i < n ? order[i] : 0;
+                strength = strength * 13 + (straight ? (i == 0 ? top : 0) : digit);
+        }
+        return strength;
+}
+
+/**
+ * Unpacks a base-13 rank key into its five ranks. Returns false unless they are sorted and could
+ * be dealt, i.e. aren't five of one rank.
+ */
+bool unpack_rank_key(uint32_t key, uint32_t ranks[5]) {
+        for (int i = 4; i >= 0; i -= 1, key /= 13) {
+                ranks[i] = key % 13;
+        }
+        for (int i = 0; i < 4; i += 1) {
+                if (ranks[i] > ranks[i + 1]) {
+                        return false;
+                }
+        }
+        return ranks[0] != ranks[4];
+}
+
+int compare_strengths(const void *a, const void *b) {
+        uint64_t x = *(const uint64_t *)a;
+        uint64_t y = *(const uint64_t *)b;
+        return x < y ? 1 : x > y ? -1 : 0;
+}
+
+/**
+ * Returns the position of `strength` in the descending `strengths`, which is its score
+ */
+uint16_t strength_score(const uint64_t *strengths, uint32_t count, uint64_t strength) {
+        uint64_t *found = bsearch(&strength, strengths, count, sizeof(uint64_t), compare_strengths);
+        return found - strengths;
+}
+
+/**
+ * Ranks every five-card hand by strength into the reference tables. Returns false if the number
+ * of distinct strengths isn't the expected 7462.
+ */
+bool init_reference() {
+        uint64_t *strengths = malloc((NUM_RANK_KEYS + (1 << 13)) * sizeof(uint64_t));
+        uint32_t count = 0;
+        uint32_t ranks[5];
+
+        // Every rank key, and then every five distinct suited ranks
+        for (uint32_t key = 0; key < NUM_RANK_KEYS; key += 1) {
+                if (unpack_rank_key(key, ranks)) {
+                        strengths[count++] = five_card_strength(ranks, false);
+                }
+        }
+        for (uint32_t mask = 0; mask < 1 << 13; mask += 1) {
+                if (__builtin_popcount(mask) == 5) {
+                        for (uint32_t i = 0, rest = mask; i < 5; i += 1, rest &= rest - 1) {
+                                ranks[i] = __builtin_ctz(rest);
+                        }
+                        strengths[count++] = five_card_strength(ranks, true);
+                }
+        }
+
+        qsort(strengths, count, sizeof(uint64_t), compare_strengths);
+        uint32_t distinct = 0;
+        for (uint32_t i = 0; i < count; i += 1) {
+                if (distinct == 0 || strengths[i] != strengths[distinct - 1]) {
+                        strengths[distinct++] = strengths[i];
+                }
+        }
+        if (distinct != NUM_HANDS) {
+                fprintf(stderr, "Reference has %u distinct hands, expected %d\n", distinct,
+                        NUM_HANDS);
+                free(strengths);
+                return false;
+        }
+
+        for (uint32_t key = 0; key < NUM_RANK_KEYS; key += 1) {
+                if (unpack_rank_key(key, ranks)) {
+                        reference_rank_scores[key] = strength_score(
+                            strengths, distinct, five_card_strength(ranks, false));
+                }
+        }
+        for (uint32_t mask = 0; mask < 1 << 13; mask += 1) {
+                if (__builtin_popcount(mask) == 5) {
+                        for (uint32_t i = 0, rest = mask; i < 5; i += 1, rest &= rest - 1) {
+                                ranks[i] = __builtin_ctz(rest);
+                        }
+                        reference_flush_scores[mask] = strength_score(
+                            strengths, distinct, five_card_strength(ranks, true));
+                }
+        }
+
+        int n = 0;
+        for (int a = 0; a < 6; a += 1) {
+                for (int b = a + 1; b < 6; b += 1) {
+                        for (int c = b + 1; c < 6; c += 1) {
+                                for (int d = c + 1; d < 6; d += 1) {
+                                        subsets_of_six[n][0] = a;
+                                        subsets_of_six[n][1] = b;
+                                        subsets_of_six[n][2] = c;
+                                        subsets_of_six[n][3] = d;
+                                        n += 1;
+                                }
+                        }
+                }
+        }
+
+        free(strengths);
+        return true;
+}
+
+/**
+ * Returns the reference score of five cards numbered rank * 4 + suit, sorted by rank
+ */
+uint32_t reference_five(const uint32_t *cards) {
+        uint32_t key = 0;
+        uint32_t mask = 0;
+        uint32_t suits = 0;
+        for (int i = 0; i < 5; i += 1) {
+                key = key * 13 + cards[i] / 4;
+                mask |= 1 << (cards[i] / 4);
+                suits |= 1 << (cards[i] % 4);
+        }
+        return suits == (suits & -suits) ? reference_flush_scores[mask]
+                                         : reference_rank_scores[key];
+}
+
+struct VerifyJob {
+        const enum EvalEngine *engines;
+        uint32_t num_engines;
+        // Work is handed out by the first two cards, 1326 units of very uneven size
+        uint32_t next_unit;
+        pthread_mutex_t mutex;
+        uint64_t hands;
+        uint64_t mismatches[NUM_ENGINES];
+        uint64_t histograms[NUM_ENGINES][NUM_CATEGORIES];
+};
+
+/**
+ * Prints one mismatch, unless enough have been printed already
+ */
+void report_mismatch(struct VerifyJob *job, enum EvalEngine engine, Card hand, uint32_t expected,
+                     uint32_t actual) {
+        pthread_mutex_lock(&job->mutex);
+        if (job->mismatches[engine] < MAX_REPORTED_MISMATCHES) {
+                char name[15];
+                format_cards(hand, name);
+                printf("%s: %s scored %u, expected %u\n", ENGINE_NAMES[engine], name, actual,
+                       expected);
+        }
+        job->mismatches[engine] += 1;
+        pthread_mutex_unlock(&job->mutex);
+}
+
+void *verify_worker(void *arg) {
+        struct VerifyJob *job = arg;
+        uint64_t hands = 0;
+        uint64_t histograms[NUM_ENGINES][NUM_CATEGORIES] = {0};
+        uint32_t c[7];
+        Card bits[52];
+        for (uint32_t card = 0; card < 52; card += 1) {
+                bits[card] = 1ull << (16 * (card % 4) + card / 4);
+        }
+
+        for (;;) {
+                uint32_t unit = __atomic_fetch_add(&job->next_unit, 1, __ATOMIC_RELAXED);
+                if (unit >= 52 * 52) {
+                        break;
+                }
+                c[0] = unit / 52;
+                c[1] = unit % 52;
+                if (c[1] <= c[0] || c[1] > 46) {
+                        continue;
+                }
+
+                for (c[2] = c[1] + 1; c[2] < 48; c[2] += 1) {
+                for (c[3] = c[2] + 1; c[3] < 49; c[3] += 1) {
+                for (c[4] = c[3] + 1; c[4] < 50; c[4] += 1) {
+                for (c[5] = c[4] + 1; c[5] < 51; c[5] += 1) {
+                        // The subsets without the last card, and the partial keys, rank masks
+                        // and common suits of the four-card subsets of the first six
+                        uint32_t best_of_six = UINT32_MAX;
+                        for (int skip = 0; skip < 6; skip += 1) {
+                                uint32_t five[5];
+                                for (int i = 0, j = 0; i < 6; i += 1) {
+                                        if (i != skip) {
+                                                five[j++] = c[i];
+                                        }
+                                }
+                                uint32_t score = reference_five(five);
+                                best_of_six = score < best_of_six ? score : best_of_six;
+                        }
+
+                        uint32_t keys[15], masks[15], suits[15];
+                        for (int s = 0; s < 15; s += 1) {
+                                keys[s] = masks[s] = suits[s] = 0;
+                                for (int i = 0; i < 4; i += 1) {
+                                        uint32_t card = c[subsets_of_six[s][i]];
+                                        keys[s] = keys[s] * 13 + card / 4;
+                                        masks[s] |= 1 << (card / 4);
+                                        suits[s] |= 1 << (card % 4);
+                                }
+                        }
+
+                        Card six = bits[c[0]] | bits[c[1]] | bits[c[2]] | bits[c[3]] |
+                                   bits[c[4]] | bits[c[5]];
+                        for (c[6] = c[5] + 1; c[6] < 52; c[6] += 1) {
+                                uint32_t rank = c[6] / 4;
+                                uint32_t suit = 1 << (c[6] % 4);
+                                uint32_t expected = best_of_six;
+                                for (int s = 0; s < 15; s += 1) {
+                                        uint32_t score =
+                                            suits[s] == suit
+                                                ? reference_flush_scores[masks[s] | 1 << rank]
+                                                : reference_rank_scores[keys[s] * 13 + rank];
+                                        expected = score < expected ? score : expected;
+                                }
+
+                                Card hand = six | bits[c[6]];
+                                for (uint32_t e = 0; e < job->num_engines; e += 1) {
+                                        enum EvalEngine engine = job->engines[e];
+                                        uint32_t actual = engine_functions[engine](hand);
+                                        histograms[engine][score_category(actual)] += 1;
+                                        if (actual != expected) {
+                                                report_mismatch(job, engine, hand, expected,
+                                                                actual);
+                                        }
+                                }
+                                hands += 1;
+                        }
+                }
+                }
+                }
+                }
+        }
+
+        pthread_mutex_lock(&job->mutex);
+        job->hands += hands;
+        for (int e = 0; e < NUM_ENGINES; e += 1) {
+                for (int k = 0; k < NUM_CATEGORIES; k += 1) {
+                        job->histograms[e][k] += histograms[e][k];
+                }
+        }
+        pthread_mutex_unlock(&job->mutex);
+        return NULL;
+}
+
+void usage(const char *program) {
+        fprintf(stderr, "usage: %s [-t threads] [--engine name]...\n", program);
+        fprintf(stderr, "  engines:");
+        for (int i = 0; i < NUM_ENGINES; i += 1) {
+                fprintf(stderr, " %s", ENGINE_NAMES[i]);
+        }
+        fprintf(stderr, " (default: all)\n");
+}
+
+int main(int argc, char **argv) {
+        enum EvalEngine engines[NUM_ENGINES];
+        uint32_t num_engines = 0;
+        uint32_t num_threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+        for (int i = 1; i < argc; i += 1) {
+                if ((strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--threads") == 0) &&
+                    i + 1 < argc) {
+                        num_threads = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "--engine") == 0 && i + 1 < argc &&
+                           parse_engine(argv[i + 1]) != NUM_ENGINES &&
+                           num_engines < NUM_ENGINES) {
+                        engines[num_engines++] = parse_engine(argv[++i]);
+                } else {
+                        usage(argv[0]);
+                        return 1;
+                }
+        }
+        if (num_threads < 1) {
+                num_threads = 1;
+        }
+        // A table that went bad on disk would fail the check anyway, but this names the cause
+        verify_table_checksums = true;
+        if (num_engines == 0) {
+                for (int i = 0; i < NUM_ENGINES; i += 1) {
+                        engines[num_engines++] = i;
+                }
+        }
+
+        for (uint32_t e = 0; e < num_engines; e += 1) {
+                if (!init_engine(engines[e])) {
+                        return 1;
+                }
+        }
+        if (!init_reference()) {
+                return 1;
+        }
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        struct VerifyJob *job = calloc(1, sizeof(struct VerifyJob));
+        job->engines = engines;
+        job->num_engines = num_engines;
+        pthread_mutex_init(&job->mutex, NULL);
+
+        pthread_t threads[num_threads];
+        uint32_t spawned = 0;
+        while (spawned + 1 < num_threads &&
+               pthread_create(&threads[spawned], NULL, verify_worker, job) == 0) {
+                spawned += 1;
+        }
+        verify_worker(job);
+        for (uint32_t t = 0; t < spawned; t += 1) {
+                pthread_join(threads[t], NULL);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        printf("Verified %lu hands on %u threads in %.2fs\n", job->hands, num_threads, seconds);
+
+        bool ok = job->hands == ALL_HANDS;
+        for (uint32_t e = 0; e < num_engines; e += 1) {
+                enum EvalEngine engine = engines[e];
+                printf("%s: %lu mismatches\n", ENGINE_NAMES[engine], job->mismatches[engine]);
+                ok &= job->mismatches[engine] == 0;
+
+                for (int k = 0; k < NUM_CATEGORIES; k += 1) {
+                        uint64_t count = job->histograms[engine][k];
+                        bool matches = count == CATEGORY_TOTALS[k];
+                        printf("  %-14s %9lu%s\n", CATEGORY_NAMES[k], count,
+                               matches ? "" : " (wrong count)");
+                        ok &= matches;
+                }
+        }
+
+        printf("%s\n", ok ? "All hands verified." : "Verification FAILED.");
+        free(job);
+        return ok ? 0 : 1;
+}